@@ -2,6 +2,8 @@
 #include "barretenberg/common/assert.hpp"
 #include <cstdlib>
 #include "barretenberg/ecc/curves/bn254/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/ecc/curves/bn254/scalar_multiplication/bucket_width_profile.hpp"
+#include "barretenberg/ecc/curves/bn254/scalar_multiplication/fixed_base.hpp"
 #include "barretenberg/srs/reference_string/file_reference_string.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
 
@@ -74,6 +76,17 @@ int pippenger()
     return 0;
 }
 
+int pippenger_fixed_base(const scalar_multiplication::fixed_base_table& table)
+{
+    std::chrono::steady_clock::time_point time_start = std::chrono::steady_clock::now();
+    g1::element result = scalar_multiplication::pippenger_fixed_base(&scalars[0], table, 0, NUM_POINTS);
+    std::chrono::steady_clock::time_point time_end = std::chrono::steady_clock::now();
+    std::chrono::microseconds diff = std::chrono::duration_cast<std::chrono::microseconds>(time_end - time_start);
+    std::cout << "run time: " << diff.count() << "us" << std::endl;
+    std::cout << result.x << std::endl;
+    return 0;
+}
+
 int coset_fft_split()
 {
     std::chrono::steady_clock::time_point time_start = std::chrono::steady_clock::now();
@@ -94,10 +107,32 @@ int coset_fft_regular()
     return 0;
 }
 
-int main()
+/**
+ * Benchmark candidate bucket widths for every power of two up to NUM_POINTS, at the current thread count, and merge the
+ * results into the profile at `profile_path`. Run once per OMP_NUM_THREADS setting of interest.
+ **/
+int calibrate(std::string const& profile_path)
+{
+    scalar_multiplication::load_bucket_width_profile(profile_path);
+    const auto entries = scalar_multiplication::calibrate_bucket_widths(
+        reference_string->get_monomial_points(), &scalars[0], 1 << 10, NUM_POINTS);
+    for (const auto& entry : entries) {
+        std::cout << entry.num_threads << " threads, " << entry.num_points << " points: bucket width "
+                  << entry.bucket_width << " (default "
+                  << scalar_multiplication::get_default_bucket_width(entry.num_points) << ")" << std::endl;
+    }
+    scalar_multiplication::save_bucket_width_profile(profile_path);
+    std::cout << "saved bucket width profile to " << profile_path << std::endl;
+    return 0;
+}
+
+int main(int argc, char** argv)
 {
     std::cout << "initializing" << std::endl;
     init();
+    if (argc > 2 && std::string(argv[1]) == "calibrate") {
+        return calibrate(argv[2]);
+    }
     std::cout << "executing normal fft" << std::endl;
     coset_fft_regular();
     std::cout << "executing sliced fft" << std::endl;
@@ -108,5 +143,19 @@ int main()
     pippenger();
     pippenger();
     pippenger();
+
+    std::cout << "precomputing fixed base table" << std::endl;
+    std::chrono::steady_clock::time_point time_start = std::chrono::steady_clock::now();
+    scalar_multiplication::fixed_base_table table(reference_string->get_monomial_points(), NUM_POINTS);
+    std::chrono::steady_clock::time_point time_end = std::chrono::steady_clock::now();
+    std::chrono::microseconds diff = std::chrono::duration_cast<std::chrono::microseconds>(time_end - time_start);
+    std::cout << "precompute time: " << diff.count() << "us, " << table.num_rounds << " windows of "
+              << table.window_bits << " bits" << std::endl;
+    std::cout << "executing fixed base pippenger algorithm" << std::endl;
+    pippenger_fixed_base(table);
+    pippenger_fixed_base(table);
+    pippenger_fixed_base(table);
+    pippenger_fixed_base(table);
+    pippenger_fixed_base(table);
     return 0;
 }
@@ -25,4 +25,38 @@ inline size_t compute_num_threads()
     num_threads = static_cast<size_t>(1ULL << numeric::get_msb(num_threads));
     return num_threads;
 }
+
+//
+// The number of threads available to openmp, NOT rounded down to a power of two.
+// Algorithms that split their work with `get_thread_range` (the FFT butterflies, pippenger) use this, so that e.g. a
+// 96-core machine runs 96 threads rather than 64.
+inline size_t compute_num_threads_unrounded()
+{
+#ifndef NO_MULTITHREADING
+    return static_cast<size_t>(omp_get_max_threads());
+#else
+    return 1;
+#endif
+}
+
+struct thread_range {
+    size_t start;
+    size_t end;
+};
+
+//
+// Split [0, size) into `num_threads` contiguous ranges, and return the range of thread `thread_index`.
+// Range boundaries are multiples of `granularity`, and range sizes differ by at most one `granularity`, except for the
+// last range which also absorbs `size % granularity`.
+inline thread_range get_thread_range(const size_t size,
+                                     const size_t num_threads,
+                                     const size_t thread_index,
+                                     const size_t granularity = 1)
+{
+    const size_t num_blocks = size / granularity;
+    const size_t start = ((num_blocks * thread_index) / num_threads) * granularity;
+    const size_t end =
+        (thread_index == num_threads - 1) ? size : ((num_blocks * (thread_index + 1)) / num_threads) * granularity;
+    return { start, end };
+}
 } // namespace max_threads
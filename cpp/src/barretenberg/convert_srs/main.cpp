@@ -0,0 +1,56 @@
+#include "barretenberg/ecc/curves/bn254/scalar_multiplication/pippenger.hpp"
+#include "barretenberg/ecc/curves/bn254/scalar_multiplication/point_table_cache.hpp"
+#include "barretenberg/srs/io.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+using namespace barretenberg;
+
+/**
+ * Converts the monomial points of an Ignition transcript into a point table cache, which provers then map instead of
+ * reading the transcript (see point_table_cache.hpp).
+ *
+ * usage: convert_srs <transcript dir> <num points> [cache path]
+ *
+ * The cache path defaults to the one `Pippenger` looks for in the transcript directory.
+ */
+int main(int argc, char** argv)
+{
+    if (argc < 3) {
+        std::cerr << "usage: " << argv[0] << " <transcript dir> <num points> [cache path]" << std::endl;
+        return 1;
+    }
+    const std::string dir = argv[1];
+    const size_t num_points = std::strtoul(argv[2], nullptr, 10);
+    const std::string cache_path =
+        argc > 3 ? std::string(argv[3]) : scalar_multiplication::get_point_table_cache_path(dir);
+    if (num_points == 0) {
+        std::cerr << "num points must be positive" << std::endl;
+        return 1;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    auto* point_table = scalar_multiplication::point_table_alloc<g1::affine_element>(num_points);
+    io::read_transcript_g1(point_table, num_points, dir);
+    scalar_multiplication::generate_pippenger_point_table(point_table, point_table, num_points);
+    auto end = std::chrono::steady_clock::now();
+    std::cout << "read " << num_points << " points from " << dir << " in "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms" << std::endl;
+
+    scalar_multiplication::write_point_table_cache(cache_path, point_table, num_points);
+    aligned_free(point_table);
+
+    start = std::chrono::steady_clock::now();
+    size_t mapped_size = 0;
+    auto* mapped = scalar_multiplication::map_point_table_cache(cache_path, num_points, mapped_size);
+    end = std::chrono::steady_clock::now();
+    if (mapped == nullptr) {
+        std::cerr << "unable to map " << cache_path << " after writing it" << std::endl;
+        return 1;
+    }
+    scalar_multiplication::unmap_point_table_cache(mapped, mapped_size);
+    std::cout << "wrote " << cache_path << ", which maps and verifies in "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms" << std::endl;
+    return 0;
+}
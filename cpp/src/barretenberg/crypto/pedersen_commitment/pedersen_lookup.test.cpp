@@ -251,3 +251,32 @@ TEST(pedersen_lookup, merkle_damgard_tree_compress)
                              compute_expected(fq(m), (crypto::pedersen_hash::lookup::NUM_PEDERSEN_TABLES / 2)))
                   .x);
 }
+
+TEST(pedersen_lookup, hash_multiple_pairs)
+{
+    typedef grumpkin::fq fq;
+
+    // Cover an empty call, a partial batch, exactly one batch, and a batch plus a partial one.
+    constexpr size_t batch_size = crypto::pedersen_hash::lookup::PAIR_BATCH_SIZE;
+    for (const size_t num_pairs : { 0UL, 1UL, batch_size - 1, batch_size, 2 * batch_size + 5 }) {
+        for (const size_t hash_index : { 0UL, 3UL }) {
+            std::vector<fq> inputs(num_pairs * 2);
+            for (auto& input : inputs) {
+                input = fq(engine.get_random_uint256());
+            }
+            // Equal halves are hashed like any other pair.
+            if (num_pairs > 0) {
+                inputs[1] = inputs[0];
+            }
+
+            std::vector<fq> outputs(num_pairs);
+            crypto::pedersen_hash::lookup::hash_multiple_pairs(inputs, outputs, hash_index);
+
+            for (size_t i = 0; i < num_pairs; ++i) {
+                const auto expected =
+                    crypto::pedersen_hash::lookup::hash_multiple({ inputs[2 * i], inputs[2 * i + 1] }, hash_index);
+                EXPECT_EQ(outputs[i], expected);
+            }
+        }
+    }
+}
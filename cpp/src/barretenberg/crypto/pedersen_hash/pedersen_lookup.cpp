@@ -1,5 +1,7 @@
 #include "./pedersen_lookup.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <mutex>
 
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
@@ -16,56 +18,46 @@ std::array<grumpkin::g1::affine_element, NUM_PEDERSEN_TABLES> generators;
 std::mutex init_mutex;
 #endif
 
-static bool inited = false;
+static std::atomic<bool> inited = false;
 
-void init_single_lookup_table(const size_t index)
+/**
+ * Fill `table` with generator * 1, ..., generator * size. Each point is the previous one plus the generator, which is
+ * much cheaper than a scalar multiplication per point, and gives the same points once normalized.
+ */
+void init_multiples_table(std::vector<grumpkin::g1::affine_element>& table,
+                          const grumpkin::g1::affine_element& generator,
+                          const size_t size)
 {
     std::vector<grumpkin::g1::element> temp;
-    temp.reserve(PEDERSEN_TABLE_SIZE);
-    pedersen_tables[index].reserve(PEDERSEN_TABLE_SIZE);
+    temp.reserve(size);
+    table.reserve(size);
 
-    const auto& generator = generators[index];
-    for (size_t i = 0; i < PEDERSEN_TABLE_SIZE; ++i) {
-        temp.emplace_back(generator * grumpkin::fr(i + 1));
+    grumpkin::g1::element accumulator(generator);
+    for (size_t i = 0; i < size; ++i) {
+        temp.emplace_back(accumulator);
+        accumulator += generator;
     }
-    grumpkin::g1::element::batch_normalize(&temp[0], PEDERSEN_TABLE_SIZE);
+    grumpkin::g1::element::batch_normalize(&temp[0], size);
 
+    // The points are normalized, so take their coordinates as they are rather than inverting z = 1 once per point.
     for (const auto& element : temp) {
-        pedersen_tables[index].emplace_back(element);
+        table.emplace_back(element.x, element.y);
     }
 }
 
-void init_small_lookup_table(const size_t index)
+void init_single_lookup_table(const size_t index)
 {
-    std::vector<grumpkin::g1::element> temp;
-    temp.reserve(PEDERSEN_SMALL_TABLE_SIZE);
-    pedersen_tables[index].reserve(PEDERSEN_SMALL_TABLE_SIZE);
-
-    const auto& generator = generators[index];
-    for (size_t i = 0; i < PEDERSEN_SMALL_TABLE_SIZE; ++i) {
-        temp.emplace_back(generator * grumpkin::fr(i + 1));
-    }
-    grumpkin::g1::element::batch_normalize(&temp[0], PEDERSEN_SMALL_TABLE_SIZE);
+    init_multiples_table(pedersen_tables[index], generators[index], PEDERSEN_TABLE_SIZE);
+}
 
-    for (const auto& element : temp) {
-        pedersen_tables[index].emplace_back(element);
-    }
+void init_small_lookup_table(const size_t index)
+{
+    init_multiples_table(pedersen_tables[index], generators[index], PEDERSEN_SMALL_TABLE_SIZE);
 }
 
 void init_iv_lookup_table()
 {
-    std::vector<grumpkin::g1::element> temp;
-    temp.reserve(PEDERSEN_IV_TABLE_SIZE);
-    pedersen_iv_table.reserve(PEDERSEN_IV_TABLE_SIZE);
-
-    for (size_t i = 0; i < PEDERSEN_IV_TABLE_SIZE; ++i) {
-        temp.emplace_back(grumpkin::g1::affine_one * grumpkin::fr(i + 1));
-    }
-    grumpkin::g1::element::batch_normalize(&temp[0], PEDERSEN_IV_TABLE_SIZE);
-
-    for (const auto& element : temp) {
-        pedersen_iv_table.emplace_back(element);
-    }
+    init_multiples_table(pedersen_iv_table, grumpkin::g1::affine_one, PEDERSEN_IV_TABLE_SIZE);
 }
 
 void init()
@@ -73,11 +65,16 @@ void init()
     ASSERT(BITS_PER_TABLE < BITS_OF_BETA);
     ASSERT(BITS_PER_TABLE + BITS_OF_BETA < BITS_ON_CURVE);
 
+    // Every hash calls this, so avoid taking the lock once the tables are built.
+    if (inited.load(std::memory_order_acquire)) {
+        return;
+    }
+
 #if !defined(__wasm__)
     const std::lock_guard<std::mutex> lock(init_mutex);
 #endif
 
-    if (inited) {
+    if (inited.load(std::memory_order_relaxed)) {
         return;
     }
     generators = grumpkin::g1::derive_generators<NUM_PEDERSEN_TABLES>();
@@ -91,7 +88,7 @@ void init()
     }
     init_small_lookup_table(2 * first_half + 1);
     init_iv_lookup_table();
-    inited = true;
+    inited.store(true, std::memory_order_release);
 }
 
 grumpkin::g1::affine_element get_table_generator(const size_t table_index)
@@ -178,6 +175,116 @@ grumpkin::fq hash_multiple(const std::vector<grumpkin::fq>& inputs, const size_t
     return final_result.x;
 }
 
+namespace {
+/**
+ * Sets `outputs[i] = hash_single(inputs[i], parity)` for a batch of inputs. The rounds are the outer loop, so that
+ * consecutive additions go to different accumulators and do not depend on each other.
+ */
+void hash_single_batch(const grumpkin::fq* inputs,
+                       const size_t num_inputs,
+                       const bool parity,
+                       grumpkin::g1::element* outputs)
+{
+    ASSERT(num_inputs <= PAIR_BATCH_SIZE);
+    constexpr size_t num_rounds = NUM_PEDERSEN_TABLES / 2;
+    constexpr uint64_t table_mask = PEDERSEN_TABLE_SIZE - 1;
+    const size_t table_index_offset = parity ? (NUM_PEDERSEN_TABLES / 2) : 0;
+
+    std::array<uint256_t, PAIR_BATCH_SIZE> bits;
+    std::array<grumpkin::g1::element, PAIR_BATCH_SIZE> accumulators;
+    for (size_t j = 0; j < num_inputs; ++j) {
+        bits[j] = uint256_t(inputs[j]);
+    }
+
+    for (size_t i = 0; i < num_rounds; ++i) {
+        const auto& table = pedersen_tables[table_index_offset + i];
+        for (size_t j = 0; j < num_inputs; ++j) {
+            const uint64_t slice_a = (bits[j].data[0] & table_mask);
+            const uint64_t slice_b = ((bits[j].data[0] >> BITS_PER_TABLE) & table_mask);
+            bits[j] >>= (2 * BITS_PER_TABLE);
+
+            // P = g * (b) + g * (a * lambda)
+            if (i == 0) {
+                outputs[j] = table[static_cast<size_t>(slice_a)];
+                accumulators[j] = table[static_cast<size_t>(slice_b)];
+            } else {
+                outputs[j] += table[static_cast<size_t>(slice_a)];
+                if (i < (num_rounds - 1)) {
+                    accumulators[j] += table[static_cast<size_t>(slice_b)];
+                }
+            }
+        }
+    }
+
+    const grumpkin::fq beta = grumpkin::fq::cube_root_of_unity();
+    for (size_t j = 0; j < num_inputs; ++j) {
+        outputs[j].x *= beta;
+        outputs[j] += accumulators[j];
+    }
+}
+
+/**
+ * Sets `outputs[i]` to the affine x-coordinate of `points[i]`, with a single inversion for the whole batch.
+ */
+void batch_affine_x(grumpkin::g1::element* points, const size_t num_points, grumpkin::fq* outputs)
+{
+    grumpkin::g1::element::batch_normalize(points, num_points);
+    for (size_t j = 0; j < num_points; ++j) {
+        // The point at infinity is flagged in x, which batch_normalize leaves alone.
+        outputs[j] = points[j].is_point_at_infinity() ? grumpkin::g1::affine_element(points[j]).x : points[j].x;
+    }
+}
+} // namespace
+
+void hash_multiple_pairs(std::span<const grumpkin::fq> inputs, std::span<grumpkin::fq> outputs, const size_t hash_index)
+{
+    ASSERT(inputs.size() == outputs.size() * 2);
+    if (outputs.empty()) {
+        return;
+    }
+    init();
+
+    // Every pair starts from the same IV and ends with the same input count, so those terms are shared.
+    const grumpkin::g1::affine_element iv_term(hash_single(pedersen_iv_table[hash_index].x, false));
+    const grumpkin::g1::affine_element length_term(hash_single(grumpkin::fq(2), true));
+
+    std::array<grumpkin::fq, PAIR_BATCH_SIZE> lefts;
+    std::array<grumpkin::fq, PAIR_BATCH_SIZE> rights;
+    std::array<grumpkin::fq, PAIR_BATCH_SIZE> state;
+    std::array<grumpkin::g1::element, PAIR_BATCH_SIZE> points;
+    std::array<grumpkin::g1::element, PAIR_BATCH_SIZE> right_points;
+
+    for (size_t start = 0; start < outputs.size(); start += PAIR_BATCH_SIZE) {
+        const size_t num_pairs = std::min(PAIR_BATCH_SIZE, outputs.size() - start);
+        for (size_t j = 0; j < num_pairs; ++j) {
+            lefts[j] = inputs[2 * (start + j)];
+            rights[j] = inputs[2 * (start + j) + 1];
+        }
+
+        // state = hash_pair(iv, left)
+        hash_single_batch(&lefts[0], num_pairs, true, &points[0]);
+        for (size_t j = 0; j < num_pairs; ++j) {
+            points[j] += iv_term;
+        }
+        batch_affine_x(&points[0], num_pairs, &state[0]);
+
+        // state = hash_pair(state, right)
+        hash_single_batch(&state[0], num_pairs, false, &points[0]);
+        hash_single_batch(&rights[0], num_pairs, true, &right_points[0]);
+        for (size_t j = 0; j < num_pairs; ++j) {
+            points[j] += right_points[j];
+        }
+        batch_affine_x(&points[0], num_pairs, &state[0]);
+
+        // output = hash_pair(state, 2)
+        hash_single_batch(&state[0], num_pairs, false, &points[0]);
+        for (size_t j = 0; j < num_pairs; ++j) {
+            points[j] += length_term;
+        }
+        batch_affine_x(&points[0], num_pairs, &outputs[start]);
+    }
+}
+
 } // namespace lookup
 } // namespace pedersen_hash
 } // namespace crypto
\ No newline at end of file
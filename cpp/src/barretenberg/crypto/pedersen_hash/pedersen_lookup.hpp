@@ -1,6 +1,7 @@
 #pragma once
 
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include <span>
 
 namespace crypto {
 namespace pedersen_hash {
@@ -18,6 +19,7 @@ constexpr size_t NUM_PEDERSEN_TABLES_RAW = (BITS_PER_HASH / (BITS_PER_TABLE * TA
 constexpr size_t NUM_PEDERSEN_TABLES = NUM_PEDERSEN_TABLES_RAW + (NUM_PEDERSEN_TABLES_RAW & 1);
 constexpr size_t PEDERSEN_IV_TABLE_SIZE = (1UL) << 10;
 constexpr size_t NUM_PEDERSEN_IV_TABLES = 4;
+constexpr size_t PAIR_BATCH_SIZE = 64;
 
 extern std::array<std::vector<grumpkin::g1::affine_element>, NUM_PEDERSEN_TABLES> pedersen_tables;
 extern std::vector<grumpkin::g1::affine_element> pedersen_iv_table;
@@ -39,6 +41,17 @@ grumpkin::fq hash_pair(const grumpkin::fq& left, const grumpkin::fq& right);
 
 grumpkin::fq hash_multiple(const std::vector<grumpkin::fq>& inputs, const size_t hash_index = 0);
 
+/**
+ * Sets `outputs[i] = hash_multiple({ inputs[2 * i], inputs[2 * i + 1] }, hash_index)` for every i.
+ *
+ * The pairs are hashed PAIR_BATCH_SIZE at a time. Within a batch every conversion to affine form shares one batch
+ * inversion, and the table additions of different pairs are interleaved. The hashes of the IV and of the input count
+ * are computed once per call rather than once per pair.
+ */
+void hash_multiple_pairs(std::span<const grumpkin::fq> inputs,
+                         std::span<grumpkin::fq> outputs,
+                         const size_t hash_index = 0);
+
 } // namespace lookup
 } // namespace pedersen_hash
 } // namespace crypto
\ No newline at end of file
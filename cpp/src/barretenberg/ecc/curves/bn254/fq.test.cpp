@@ -446,6 +446,22 @@ TEST(fq, serialize_from_buffer)
     EXPECT_EQ((result == expected), true);
 }
 
+TEST(fq, mul_batch)
+{
+    constexpr size_t n = 21;
+    std::vector<fq> a(n);
+    std::vector<fq> b(n);
+    for (size_t i = 0; i < n; ++i) {
+        a[i] = fq::random_element();
+        b[i] = fq::random_element();
+    }
+    std::vector<fq> result(n);
+    fq::mul_batch(a, b, result);
+    for (size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(result[i], a[i] * b[i]);
+    }
+}
+
 TEST(fq, multiplicative_generator)
 {
     EXPECT_EQ(fq::multiplicative_generator(), fq(3));
@@ -353,6 +353,75 @@ TEST(fr, batch_invert)
     }
 }
 
+TEST(fr, batch_invert_with_zeroes)
+{
+    // large enough to use the interleaved chains, with a partial last chunk
+    constexpr size_t n = 43;
+    std::vector<fr> coeffs(n);
+    for (size_t i = 0; i < n; ++i) {
+        coeffs[i] = (i % 7 == 3) ? fr::zero() : fr::random_element();
+    }
+    std::vector<fr> inverses(coeffs);
+    fr::batch_invert(inverses);
+
+    for (size_t i = 0; i < n; ++i) {
+        if (coeffs[i].is_zero()) {
+            EXPECT_EQ(inverses[i], fr::zero());
+        } else {
+            EXPECT_EQ(coeffs[i] * inverses[i], fr::one());
+        }
+    }
+}
+
+TEST(fr, batch_invert_parallel_blocks)
+{
+    // spans several blocks, the last of them partial
+    const size_t n = 3 * fr::BATCH_INVERT_BLOCK_SIZE + 5;
+    std::vector<fr> coeffs(n);
+    for (size_t i = 0; i < n; ++i) {
+        coeffs[i] = (i % 1000 == 1) ? fr::zero() : fr::random_element();
+    }
+    std::vector<fr> inverses(coeffs);
+    fr::batch_invert(inverses);
+
+    for (size_t i = 0; i < n; ++i) {
+        if (coeffs[i].is_zero()) {
+            EXPECT_EQ(inverses[i], fr::zero());
+        } else {
+            EXPECT_EQ(coeffs[i] * inverses[i], fr::one());
+        }
+    }
+}
+
+TEST(fr, mul_batch)
+{
+    constexpr size_t n = 37;
+    std::vector<fr> a(n);
+    std::vector<fr> b(n);
+    for (size_t i = 0; i < n; ++i) {
+        a[i] = fr::random_element();
+        b[i] = fr::random_element();
+    }
+    // coarse representatives in [p, 2p) are valid inputs
+    const fr reduced = a[5].reduce_once();
+    const uint256_t coarse =
+        uint256_t(reduced.data[0], reduced.data[1], reduced.data[2], reduced.data[3]) + fr::modulus;
+    a[5] = fr{ coarse.data[0], coarse.data[1], coarse.data[2], coarse.data[3] };
+    std::vector<fr> result(n);
+    fr::mul_batch(a, b, result);
+    for (size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(result[i], a[i] * b[i]);
+    }
+
+    // the output may alias an input
+    std::vector<fr> expected(result);
+    for (size_t i = 0; i < n; ++i) {
+        expected[i] *= b[i];
+    }
+    fr::mul_batch(result, b, result);
+    EXPECT_EQ(result, expected);
+}
+
 TEST(fr, multiplicative_generator)
 {
     EXPECT_EQ(fr::multiplicative_generator(), fr(5));
@@ -0,0 +1,172 @@
+#include "./bucket_width_profile.hpp"
+
+#include "barretenberg/common/max_threads.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+
+#include "./runtime_states.hpp"
+#include "./scalar_multiplication.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <sstream>
+
+namespace barretenberg {
+namespace scalar_multiplication {
+
+namespace {
+// num_threads -> (num_points -> bucket width)
+using bucket_width_profile = std::map<size_t, std::map<size_t, size_t>>;
+
+bucket_width_profile& get_profile()
+{
+    static bucket_width_profile profile;
+    return profile;
+}
+
+size_t get_num_threads()
+{
+#ifndef NO_MULTITHREADING
+    return max_threads::compute_num_threads_unrounded();
+#else
+    return 1;
+#endif
+}
+
+[[maybe_unused]] const bool profile_loaded_from_environment = []() {
+    const char* path = std::getenv("BB_PIPPENGER_PROFILE");
+    return (path != nullptr) && load_bucket_width_profile(path);
+}();
+} // namespace
+
+size_t get_optimal_bucket_width(const size_t num_points)
+{
+    const auto& profile = get_profile();
+    if (profile.empty()) {
+        return get_default_bucket_width(num_points);
+    }
+    const auto thread_profile = profile.find(get_num_threads());
+    if (thread_profile == profile.end()) {
+        return get_default_bucket_width(num_points);
+    }
+    // find the last entry that is not larger than num_points
+    auto entry = thread_profile->second.upper_bound(num_points);
+    if (entry == thread_profile->second.begin()) {
+        return get_default_bucket_width(num_points);
+    }
+    --entry;
+    return entry->second;
+}
+
+void set_bucket_width(const size_t num_threads, const size_t num_points, const size_t bucket_width)
+{
+    if (bucket_width < MIN_BUCKET_WIDTH || bucket_width > MAX_BUCKET_WIDTH) {
+        throw_or_abort("bucket width " + std::to_string(bucket_width) + " is out of range");
+    }
+    get_profile()[num_threads][num_points] = bucket_width;
+}
+
+void clear_bucket_width_profile()
+{
+    get_profile().clear();
+}
+
+std::vector<bucket_width_profile_entry> get_bucket_width_profile()
+{
+    std::vector<bucket_width_profile_entry> entries;
+    for (const auto& [num_threads, thread_profile] : get_profile()) {
+        for (const auto& [num_points, bucket_width] : thread_profile) {
+            entries.push_back({ num_threads, num_points, bucket_width });
+        }
+    }
+    return entries;
+}
+
+/**
+ * Merge the entries of a profile file into the current profile. Returns false if the file cannot be opened or is
+ * malformed, in which case the current profile is left untouched.
+ **/
+bool load_bucket_width_profile(std::string const& path)
+{
+    std::ifstream file(path);
+    if (!file.good()) {
+        return false;
+    }
+    std::vector<bucket_width_profile_entry> entries;
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        std::istringstream stream(line);
+        bucket_width_profile_entry entry{};
+        if (!(stream >> entry.num_threads >> entry.num_points >> entry.bucket_width)) {
+            return false;
+        }
+        if (entry.bucket_width < MIN_BUCKET_WIDTH || entry.bucket_width > MAX_BUCKET_WIDTH) {
+            return false;
+        }
+        entries.push_back(entry);
+    }
+    for (const auto& entry : entries) {
+        set_bucket_width(entry.num_threads, entry.num_points, entry.bucket_width);
+    }
+    return true;
+}
+
+void save_bucket_width_profile(std::string const& path)
+{
+    std::ofstream file(path);
+    if (!file.good()) {
+        throw_or_abort("could not open bucket width profile " + path + " for writing");
+    }
+    file << "# pippenger bucket width profile\n";
+    file << "# num_threads num_points bucket_width\n";
+    for (const auto& entry : get_bucket_width_profile()) {
+        file << entry.num_threads << " " << entry.num_points << " " << entry.bucket_width << "\n";
+    }
+}
+
+std::vector<bucket_width_profile_entry> calibrate_bucket_widths(g1::affine_element* point_table,
+                                                                fr* scalars,
+                                                                const size_t min_num_points,
+                                                                const size_t max_num_points,
+                                                                const size_t num_repetitions)
+{
+    constexpr size_t CANDIDATE_RANGE = 3;
+    const size_t num_threads = get_num_threads();
+    std::vector<bucket_width_profile_entry> calibrated;
+
+    // Calibrate in increasing order. While `num_points` is being timed, its entry covers every larger size, and the
+    // smaller slices that `pippenger` may recurse into have already been calibrated.
+    for (size_t num_points = min_num_points; num_points <= max_num_points; num_points <<= 1) {
+        const size_t default_width = get_default_bucket_width(num_points);
+        const size_t min_width = std::max(MIN_BUCKET_WIDTH, default_width - std::min(default_width, CANDIDATE_RANGE));
+        const size_t max_width = std::min(MAX_BUCKET_WIDTH, default_width + CANDIDATE_RANGE);
+
+        size_t best_width = default_width;
+        auto best_time = std::chrono::nanoseconds::max();
+        for (size_t width = min_width; width <= max_width; ++width) {
+            set_bucket_width(num_threads, num_points, width);
+            pippenger_runtime_state state(num_points);
+            auto width_time = std::chrono::nanoseconds::max();
+            for (size_t i = 0; i < num_repetitions; ++i) {
+                const auto start = std::chrono::steady_clock::now();
+                pippenger_unsafe(scalars, point_table, num_points, state);
+                const auto end = std::chrono::steady_clock::now();
+                width_time = std::min(width_time, std::chrono::duration_cast<std::chrono::nanoseconds>(end - start));
+            }
+            if (width_time < best_time) {
+                best_time = width_time;
+                best_width = width;
+            }
+        }
+        set_bucket_width(num_threads, num_points, best_width);
+        calibrated.push_back({ num_threads, num_points, best_width });
+    }
+    return calibrated;
+}
+
+} // namespace scalar_multiplication
+} // namespace barretenberg
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "../fr.hpp"
+#include "../g1.hpp"
+#include <string>
+#include <vector>
+
+namespace barretenberg {
+namespace scalar_multiplication {
+
+/**
+ * Runtime-tuned pippenger bucket widths.
+ *
+ * `get_default_bucket_width` is a ladder of thresholds that was tuned once, on an 8-thread laptop. The best window size
+ * depends on cache sizes and on the number of threads the rounds are split over, so a machine can instead be
+ * calibrated (see `calibrate_bucket_widths`) and the result stored in a profile file.
+ *
+ * A profile maps (num_threads, num_points) to a bucket width. An entry for `num_points = n` applies to every
+ * multiplication of at least `n` points, up to the next entry for the same thread count. If the profile has no entry
+ * for the current thread count, `get_optimal_bucket_width` falls back to `get_default_bucket_width`.
+ *
+ * The file format is plain text, one `num_threads num_points bucket_width` triple per line. Lines starting with '#'
+ * are comments. If the environment variable BB_PIPPENGER_PROFILE is set, the profile it names is loaded at startup.
+ *
+ * The profile is global state. It must not be modified while a multi-scalar multiplication is running.
+ **/
+constexpr size_t MIN_BUCKET_WIDTH = 1;
+constexpr size_t MAX_BUCKET_WIDTH = 24;
+
+struct bucket_width_profile_entry {
+    size_t num_threads;
+    size_t num_points;
+    size_t bucket_width;
+};
+
+void set_bucket_width(const size_t num_threads, const size_t num_points, const size_t bucket_width);
+
+void clear_bucket_width_profile();
+
+std::vector<bucket_width_profile_entry> get_bucket_width_profile();
+
+bool load_bucket_width_profile(std::string const& path);
+
+void save_bucket_width_profile(std::string const& path);
+
+/**
+ * Time `pippenger_unsafe` for a range of candidate bucket widths around the default, for every power-of-two number of
+ * points in [min_num_points, max_num_points], at the current thread count. The fastest width for each size is added
+ * to the profile.
+ *
+ * `point_table` must be an endomorphism-expanded table (see `generate_pippenger_point_table`) of at least
+ * `max_num_points` points, and `scalars` must hold at least `max_num_points` scalars.
+ **/
+std::vector<bucket_width_profile_entry> calibrate_bucket_widths(g1::affine_element* point_table,
+                                                                fr* scalars,
+                                                                const size_t min_num_points,
+                                                                const size_t max_num_points,
+                                                                const size_t num_repetitions = 3);
+
+} // namespace scalar_multiplication
+} // namespace barretenberg
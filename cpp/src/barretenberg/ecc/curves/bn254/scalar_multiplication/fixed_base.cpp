@@ -0,0 +1,394 @@
+#include "./fixed_base.hpp"
+
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/mem.hpp"
+#include "barretenberg/common/max_threads.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <vector>
+
+#include "../../../groups/wnaf.hpp"
+#include "./process_buckets.hpp"
+
+#ifndef NO_MULTITHREADING
+#include <omp.h>
+#endif
+
+namespace barretenberg {
+namespace scalar_multiplication {
+
+namespace {
+constexpr size_t MAX_FIXED_BASE_WINDOW_BITS = 22;
+constexpr uint64_t FIXED_BASE_TABLE_MAGIC = 0x6262667874626c31ULL;
+
+// `construct_addition_chains` prefetches up to 32 schedule entries past the current one
+constexpr size_t SCHEDULE_PREFETCH_OVERFLOW = 32;
+
+struct fixed_base_table_header {
+    uint64_t magic;
+    uint64_t num_points;
+    uint64_t window_bits;
+    uint64_t num_rounds;
+};
+
+size_t get_num_threads()
+{
+#ifndef NO_MULTITHREADING
+    return max_threads::compute_num_threads_unrounded();
+#else
+    return 1;
+#endif
+}
+
+template <typename T> std::unique_ptr<T[], decltype(&aligned_free)> alloc_buffer(const size_t num_elements)
+{
+    return std::unique_ptr<T[], decltype(&aligned_free)>(static_cast<T*>(aligned_alloc(64, num_elements * sizeof(T))),
+                                                         &aligned_free);
+}
+} // namespace
+
+size_t get_fixed_base_table_bytes(const size_t num_points, const size_t window_bits)
+{
+    return WNAF_SIZE(window_bits) * 2 * num_points * sizeof(g1::affine_element);
+}
+
+/**
+ * Pick the window size that minimises the cost of a single fixed-base round, among those whose table fits in
+ * `max_table_bytes`. Returns 0 if none does.
+ * Every non-zero digit costs one bucket addition (~R * 2n of them), and concatenating 2^{c-1} buckets costs ~2^c
+ * additions. Larger windows also shrink the table, as R = ceil(127 / c).
+ *
+ * The table holds R copies of the 2n-point table, i.e. 128MiB per round per 2^20 points. The fastest windows take
+ * 7 rounds (0.875GiB) at 2^20 points and 6 rounds (3GiB) at 2^22 points. Under a tighter cap we take a larger window
+ * than the fastest one, trading table memory for bucket concatenation time. Even a 22-bit window needs 6 rounds, so
+ * the default 2GiB cap rules out tables for more than 2^21 points, which are then better left to the regular
+ * pippenger (whose point table is 2n points).
+ **/
+size_t get_fixed_base_window_bits(const size_t num_points, const size_t max_table_bytes)
+{
+    size_t best_bits = 0;
+    size_t best_cost = static_cast<size_t>(-1);
+    for (size_t bits = 2; bits <= MAX_FIXED_BASE_WINDOW_BITS; ++bits) {
+        if (get_fixed_base_table_bytes(num_points, bits) > max_table_bytes) {
+            continue;
+        }
+        const size_t cost = WNAF_SIZE(bits) * 2 * num_points + (1UL << bits);
+        if (cost < best_cost) {
+            best_cost = cost;
+            best_bits = bits;
+        }
+    }
+    return best_bits;
+}
+
+/**
+ * Build the table of shifted point tables. Window k is computed from window k - 1 with c doublings per point,
+ * followed by a batch normalization. We only double the even (non-endomorphism) points; the odd entries are
+ * (beta.x, -y) of their even neighbours, exactly as in `generate_pippenger_point_table`.
+ **/
+fixed_base_table::fixed_base_table(const g1::affine_element* point_table,
+                                   const size_t num_initial_points,
+                                   const size_t max_table_bytes)
+    : num_points(num_initial_points)
+    , window_bits(get_fixed_base_window_bits(num_initial_points, max_table_bytes))
+{
+    if (window_bits == 0) {
+        throw_or_abort("fixed base table for " + std::to_string(num_points) + " points does not fit in " +
+                       std::to_string(max_table_bytes) + " bytes");
+    }
+    num_rounds = WNAF_SIZE(window_bits);
+    // point indices are packed into the high 32 bits of a schedule entry
+    ASSERT(get_num_table_points() < (1ULL << 32ULL));
+
+    points = static_cast<g1::affine_element*>(
+        aligned_alloc(64, get_num_table_points() * sizeof(g1::affine_element)));
+    memcpy((void*)points, (void*)point_table, 2 * num_points * sizeof(g1::affine_element));
+
+    const fq beta = fq::cube_root_of_unity();
+    const size_t num_threads = get_num_threads();
+    const size_t points_per_thread = (num_points + num_threads - 1) / num_threads;
+    for (size_t k = 1; k < num_rounds; ++k) {
+        const g1::affine_element* previous = points + (k - 1) * 2 * num_points;
+        g1::affine_element* current = points + k * 2 * num_points;
+#ifndef NO_MULTITHREADING
+#pragma omp parallel for
+#endif
+        for (size_t j = 0; j < num_threads; ++j) {
+            const size_t start = std::min(j * points_per_thread, num_points);
+            const size_t end = std::min(start + points_per_thread, num_points);
+            if (start == end) {
+                continue;
+            }
+            std::vector<g1::element> work(end - start);
+            for (size_t i = start; i < end; ++i) {
+                g1::element& point = work[i - start];
+                point = g1::element(previous[2 * i]);
+                for (size_t l = 0; l < window_bits; ++l) {
+                    point.self_dbl();
+                }
+            }
+            g1::element::batch_normalize(&work[0], end - start);
+            for (size_t i = start; i < end; ++i) {
+                const g1::element& point = work[i - start];
+                current[2 * i] = g1::affine_element(point.x, point.y);
+                current[2 * i + 1] = g1::affine_element(beta * point.x, -point.y);
+            }
+        }
+    }
+}
+
+fixed_base_table::fixed_base_table(fixed_base_table&& other) noexcept
+    : points(other.points)
+    , num_points(other.num_points)
+    , window_bits(other.window_bits)
+    , num_rounds(other.num_rounds)
+{
+    other.points = nullptr;
+}
+
+fixed_base_table& fixed_base_table::operator=(fixed_base_table&& other) noexcept
+{
+    if (points) {
+        aligned_free(points);
+    }
+    points = other.points;
+    num_points = other.num_points;
+    window_bits = other.window_bits;
+    num_rounds = other.num_rounds;
+    other.points = nullptr;
+    return *this;
+}
+
+fixed_base_table::~fixed_base_table()
+{
+    if (points) {
+        aligned_free(points);
+    }
+}
+
+/**
+ * Load a table written by `write_fixed_base_table`. Returns false (leaving `table` untouched) if the file is missing,
+ * was built for a different number of points or window size, or if its first window does not match `point_table`
+ * (i.e. it was built from a different SRS).
+ **/
+bool read_fixed_base_table(std::string const& path,
+                           fixed_base_table& table,
+                           const g1::affine_element* point_table,
+                           const size_t num_points,
+                           const size_t max_table_bytes)
+{
+    std::ifstream file(path, std::ifstream::binary);
+    if (!file) {
+        return false;
+    }
+    fixed_base_table_header header;
+    file.read((char*)&header, sizeof(header));
+    const size_t window_bits = get_fixed_base_window_bits(num_points, max_table_bytes);
+    if (!file || window_bits == 0 || header.magic != FIXED_BASE_TABLE_MAGIC || header.num_points != num_points ||
+        header.window_bits != window_bits || header.num_rounds != WNAF_SIZE(window_bits)) {
+        return false;
+    }
+
+    fixed_base_table result;
+    result.num_points = num_points;
+    result.window_bits = window_bits;
+    result.num_rounds = WNAF_SIZE(window_bits);
+    result.points = static_cast<g1::affine_element*>(
+        aligned_alloc(64, result.get_num_table_points() * sizeof(g1::affine_element)));
+    file.read((char*)result.points, (std::streamsize)(result.get_num_table_points() * sizeof(g1::affine_element)));
+    if (!file ||
+        memcmp((void*)result.points, (void*)point_table, 2 * num_points * sizeof(g1::affine_element)) != 0) {
+        return false;
+    }
+    table = std::move(result);
+    return true;
+}
+
+void write_fixed_base_table(std::string const& path, fixed_base_table const& table)
+{
+    const fixed_base_table_header header{
+        FIXED_BASE_TABLE_MAGIC, table.num_points, table.window_bits, table.num_rounds
+    };
+    std::ofstream file(path, std::ofstream::binary);
+    file.write((char*)&header, sizeof(header));
+    file.write((char*)table.points, (std::streamsize)(table.get_num_table_points() * sizeof(g1::affine_element)));
+}
+
+/**
+ * Multi-scalar multiplication of `scalars` against points [offset, offset + num_initial_points) of the table's SRS.
+ *
+ * 1. Booth-recode every endomorphism-split scalar. Window k of point j reads its point from window k of the table,
+ *    so every schedule entry of every window maps into the same set of buckets.
+ * 2. Sort each window's schedule by bucket (one window per thread, as in `organize_buckets`).
+ * 3. Give every thread a disjoint range of buckets. A thread binary-searches each sorted window for its range and
+ *    counting-sorts the matching entries into one contiguous, bucket-ordered schedule.
+ * 4. Each thread reduces its buckets with `accumulate_buckets`. The thread results are simply summed: there are no
+ *    rounds to double between.
+ *
+ * Like `pippenger_unsafe`, this does not handle the incomplete addition formula edge cases.
+ **/
+g1::element pippenger_fixed_base(const fr* scalars,
+                                 const fixed_base_table& table,
+                                 const size_t offset,
+                                 const size_t num_initial_points)
+{
+    if (num_initial_points == 0) {
+        return g1::element::infinity();
+    }
+    ASSERT(offset + num_initial_points <= table.num_points);
+
+    const size_t num_points = num_initial_points * 2;
+    const size_t num_rounds = table.num_rounds;
+    const size_t window_bits = table.window_bits;
+    const size_t num_buckets = 1UL << (window_bits - 1);
+    const uint64_t window_point_offset = static_cast<uint64_t>(2 * table.num_points) << 32ULL;
+    const size_t num_threads = get_num_threads();
+
+    auto point_schedule = alloc_buffer<uint64_t>(num_rounds * num_points + SCHEDULE_PREFETCH_OVERFLOW);
+    std::vector<uint64_t> thread_round_counts(num_threads * num_rounds, 0);
+
+    const size_t scalars_per_thread = (num_initial_points + num_threads - 1) / num_threads;
+#ifndef NO_MULTITHREADING
+#pragma omp parallel for
+#endif
+    for (size_t j = 0; j < num_threads; ++j) {
+        const size_t start = std::min(j * scalars_per_thread, num_initial_points);
+        const size_t end = std::min(start + scalars_per_thread, num_initial_points);
+        uint64_t* round_counts = &thread_round_counts[j * num_rounds];
+        fr T0;
+        for (size_t i = start; i < end; ++i) {
+            T0 = scalars[i].from_montgomery_form();
+            fr::split_into_endomorphism_scalars(T0, T0, *(fr*)&T0.data[2]);
+
+            const uint64_t point_index = static_cast<uint64_t>(2 * (offset + i));
+            wnaf::fixed_booth_with_counts(&T0.data[0],
+                                          &point_schedule[2 * i],
+                                          round_counts,
+                                          point_index << 32ULL,
+                                          num_points,
+                                          window_bits,
+                                          window_point_offset);
+            wnaf::fixed_booth_with_counts(&T0.data[2],
+                                          &point_schedule[2 * i + 1],
+                                          round_counts,
+                                          (point_index + 1) << 32ULL,
+                                          num_points,
+                                          window_bits,
+                                          window_point_offset);
+        }
+    }
+
+    std::vector<uint64_t> round_counts(num_rounds, 0);
+    for (size_t j = 0; j < num_threads; ++j) {
+        for (size_t k = 0; k < num_rounds; ++k) {
+            round_counts[k] += thread_round_counts[j * num_rounds + k];
+        }
+    }
+
+#ifndef NO_MULTITHREADING
+#pragma omp parallel for
+#endif
+    for (size_t k = 0; k < num_rounds; ++k) {
+        process_buckets(&point_schedule[k * num_points], num_points, static_cast<uint32_t>(window_bits));
+    }
+
+    // locate each thread's bucket range [bucket_start, bucket_end) in every sorted window
+    const auto bucket_less = [](const uint64_t entry, const uint64_t bucket) { return (entry & 0x7fffffffU) < bucket; };
+    std::vector<std::pair<uint64_t*, uint64_t*>> thread_ranges(num_threads * num_rounds);
+    std::vector<size_t> thread_offsets(num_threads + 1, 0);
+#ifndef NO_MULTITHREADING
+#pragma omp parallel for
+#endif
+    for (size_t j = 0; j < num_threads; ++j) {
+        const uint64_t bucket_start = (num_buckets * j) / num_threads;
+        const uint64_t bucket_end = (num_buckets * (j + 1)) / num_threads;
+        size_t count = 0;
+        for (size_t k = 0; k < num_rounds; ++k) {
+            uint64_t* window = &point_schedule[k * num_points];
+            uint64_t* window_end = window + round_counts[k];
+            uint64_t* range_start = std::lower_bound(window, window_end, bucket_start, bucket_less);
+            uint64_t* range_end = std::lower_bound(range_start, window_end, bucket_end, bucket_less);
+            thread_ranges[j * num_rounds + k] = { range_start, range_end };
+            count += static_cast<size_t>(range_end - range_start);
+        }
+        thread_offsets[j + 1] = count;
+    }
+    for (size_t j = 0; j < num_threads; ++j) {
+        thread_offsets[j + 1] += thread_offsets[j];
+    }
+    const size_t total_points = thread_offsets[num_threads];
+
+    // per-thread bucket arrays. `bit_offsets` is indexed by log2(bucket size), so always give it some headroom
+    const size_t bucket_stride = (num_buckets + num_threads - 1) / num_threads + 64;
+    auto thread_schedule = alloc_buffer<uint64_t>(total_points + SCHEDULE_PREFETCH_OVERFLOW);
+    auto point_pairs_1 = alloc_buffer<g1::affine_element>(total_points + 16 * num_threads);
+    auto point_pairs_2 = alloc_buffer<g1::affine_element>(total_points + 16 * num_threads);
+    auto scratch_space = alloc_buffer<fq>(total_points);
+    auto bucket_counts = alloc_buffer<uint32_t>(bucket_stride * num_threads);
+    auto bit_offsets = alloc_buffer<uint32_t>(bucket_stride * num_threads);
+    auto bucket_empty_status = alloc_buffer<bool>(bucket_stride * num_threads);
+    auto thread_accumulators = alloc_buffer<g1::element>(num_threads);
+    memset((void*)&thread_schedule[total_points], 0, SCHEDULE_PREFETCH_OVERFLOW * sizeof(uint64_t));
+
+#ifndef NO_MULTITHREADING
+#pragma omp parallel for
+#endif
+    for (size_t j = 0; j < num_threads; ++j) {
+        thread_accumulators[j].self_set_infinity();
+        const size_t count = thread_offsets[j + 1] - thread_offsets[j];
+        if (count == 0) {
+            continue;
+        }
+        const uint64_t bucket_start = (num_buckets * j) / num_threads;
+        const uint64_t bucket_end = (num_buckets * (j + 1)) / num_threads;
+        uint64_t* schedule = &thread_schedule[thread_offsets[j]];
+        uint32_t* counts = &bucket_counts[j * bucket_stride];
+
+        // counting sort of this thread's entries from every window, by bucket
+        memset((void*)counts, 0, (bucket_end - bucket_start) * sizeof(uint32_t));
+        for (size_t k = 0; k < num_rounds; ++k) {
+            const auto& [range_start, range_end] = thread_ranges[j * num_rounds + k];
+            for (const uint64_t* it = range_start; it != range_end; ++it) {
+                ++counts[(*it & 0x7fffffffU) - bucket_start];
+            }
+        }
+        uint32_t running_count = 0;
+        for (size_t b = 0; b < bucket_end - bucket_start; ++b) {
+            const uint32_t bucket_count = counts[b];
+            counts[b] = running_count;
+            running_count += bucket_count;
+        }
+        for (size_t k = 0; k < num_rounds; ++k) {
+            const auto& [range_start, range_end] = thread_ranges[j * num_rounds + k];
+            for (const uint64_t* it = range_start; it != range_end; ++it) {
+                schedule[counts[(*it & 0x7fffffffU) - bucket_start]++] = *it;
+            }
+        }
+
+        affine_product_runtime_state product_state;
+        product_state.points = table.points;
+        product_state.point_pairs_1 = &point_pairs_1[thread_offsets[j] + 16 * j];
+        product_state.point_pairs_2 = &point_pairs_2[thread_offsets[j] + 16 * j];
+        product_state.scratch_space = &scratch_space[thread_offsets[j]];
+        product_state.bucket_counts = counts;
+        product_state.bit_offsets = &bit_offsets[j * bucket_stride];
+        product_state.bucket_empty_status = &bucket_empty_status[j * bucket_stride];
+        product_state.point_schedule = schedule;
+        product_state.num_points = static_cast<uint32_t>(count);
+        thread_accumulators[j] = accumulate_buckets(product_state, false, RecodingMode::BOOTH);
+    }
+
+    g1::element result;
+    result.self_set_infinity();
+    for (size_t j = 0; j < num_threads; ++j) {
+        result += thread_accumulators[j];
+    }
+    return result;
+}
+
+} // namespace scalar_multiplication
+} // namespace barretenberg
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "./scalar_multiplication.hpp"
+#include <string>
+
+namespace barretenberg {
+namespace scalar_multiplication {
+
+/**
+ * Pippenger over a fixed set of bases.
+ *
+ * The prover commits to every polynomial against the same monomial SRS. Because the bases never change, we can
+ * precompute the shifted multiples 2^{kc}.G_i of every point, for each of the R = ceil(127 / c) windows of a
+ * (endomorphism-split) scalar multiplier. A scalar with booth digits (d_0, ..., d_{R-1}) then contributes
+ * d_k.(2^{kc}.G_i) for every window k, and the digits of ALL windows can be added into ONE shared set of 2^{c-1}
+ * buckets.
+ *
+ * The R rounds of the regular algorithm collapse into a single round: we pay for one bucket concatenation instead of
+ * R, and we never double the round accumulators. In exchange the table holds R copies of the point table.
+ *
+ * Table layout: `points[k * 2 * num_points + j] = 2^{kc}.point_table[j]`, where `point_table` is the
+ * endomorphism-expanded table produced by `generate_pippenger_point_table`.
+ *
+ * The table takes R * 2n * 64 bytes, so its size is bounded by `max_table_bytes` (see `get_fixed_base_window_bits`).
+ **/
+constexpr size_t DEFAULT_MAX_FIXED_BASE_TABLE_BYTES = 2ULL << 30ULL;
+
+struct fixed_base_table {
+    g1::affine_element* points = nullptr;
+    size_t num_points = 0;
+    size_t window_bits = 0;
+    size_t num_rounds = 0;
+
+    fixed_base_table() = default;
+    /**
+     * Throws if no window size keeps the table within `max_table_bytes`.
+     */
+    fixed_base_table(const g1::affine_element* point_table,
+                     const size_t num_points,
+                     const size_t max_table_bytes = DEFAULT_MAX_FIXED_BASE_TABLE_BYTES);
+    fixed_base_table(const fixed_base_table& other) = delete;
+    fixed_base_table(fixed_base_table&& other) noexcept;
+    fixed_base_table& operator=(const fixed_base_table& other) = delete;
+    fixed_base_table& operator=(fixed_base_table&& other) noexcept;
+    ~fixed_base_table();
+
+    size_t get_num_table_points() const { return num_rounds * 2 * num_points; }
+};
+
+size_t get_fixed_base_table_bytes(const size_t num_points, const size_t window_bits);
+
+size_t get_fixed_base_window_bits(const size_t num_points,
+                                  const size_t max_table_bytes = DEFAULT_MAX_FIXED_BASE_TABLE_BYTES);
+
+bool read_fixed_base_table(std::string const& path,
+                           fixed_base_table& table,
+                           const g1::affine_element* point_table,
+                           const size_t num_points,
+                           const size_t max_table_bytes = DEFAULT_MAX_FIXED_BASE_TABLE_BYTES);
+
+void write_fixed_base_table(std::string const& path, fixed_base_table const& table);
+
+g1::element pippenger_fixed_base(const fr* scalars,
+                                 const fixed_base_table& table,
+                                 const size_t offset,
+                                 const size_t num_initial_points);
+
+} // namespace scalar_multiplication
+} // namespace barretenberg
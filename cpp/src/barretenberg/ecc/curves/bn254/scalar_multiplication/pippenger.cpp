@@ -1,4 +1,5 @@
 #include "pippenger.hpp"
+#include "point_table_cache.hpp"
 #include "barretenberg/srs/io.hpp"
 namespace barretenberg {
 namespace scalar_multiplication {
@@ -23,20 +24,51 @@ Pippenger::Pippenger(uint8_t const* points, size_t num_points)
 Pippenger::Pippenger(std::string const& path, size_t num_points)
     : num_points_(num_points)
 {
+#ifndef __wasm__
+    monomials_ = map_point_table_cache(get_point_table_cache_path(path), num_points, mapped_size_);
+    if (monomials_ != nullptr) {
+        return;
+    }
+#endif
     monomials_ = point_table_alloc<g1::affine_element>(num_points);
 
     barretenberg::io::read_transcript_g1(monomials_, num_points, path);
     barretenberg::scalar_multiplication::generate_pippenger_point_table(monomials_, monomials_, num_points);
 }
 
+bool Pippenger::enable_fixed_base_table(std::string const& cache_path, const size_t max_table_bytes)
+{
+    if (get_fixed_base_window_bits(num_points_, max_table_bytes) == 0) {
+        return false;
+    }
+    if (!cache_path.empty() &&
+        read_fixed_base_table(cache_path, fixed_base_table_, monomials_, num_points_, max_table_bytes)) {
+        return true;
+    }
+    fixed_base_table_ = fixed_base_table(monomials_, num_points_, max_table_bytes);
+    if (!cache_path.empty()) {
+        write_fixed_base_table(cache_path, fixed_base_table_);
+    }
+    return true;
+}
+
 g1::element Pippenger::pippenger_unsafe(fr* scalars, size_t from, size_t range)
 {
+    if (fixed_base_table_.points != nullptr) {
+        return scalar_multiplication::pippenger_fixed_base(scalars, fixed_base_table_, from, range);
+    }
     scalar_multiplication::pippenger_runtime_state state(range);
     return scalar_multiplication::pippenger_unsafe(scalars, monomials_ + from * 2, range, state);
 }
 
 Pippenger::~Pippenger()
 {
+#ifndef __wasm__
+    if (mapped_size_ != 0) {
+        unmap_point_table_cache(monomials_, mapped_size_);
+        return;
+    }
+#endif
     free(monomials_);
 }
 
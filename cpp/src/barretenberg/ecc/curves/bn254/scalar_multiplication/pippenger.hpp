@@ -1,5 +1,6 @@
 #pragma once
 #include "./scalar_multiplication.hpp"
+#include "./fixed_base.hpp"
 #include "barretenberg/common/mem.hpp"
 #include "barretenberg/common/max_threads.hpp"
 
@@ -13,7 +14,7 @@ namespace scalar_multiplication {
 inline size_t point_table_size(size_t num_points)
 {
 #ifndef NO_MULTITHREADING
-    const size_t num_threads = max_threads::compute_num_threads();
+    const size_t num_threads = max_threads::compute_num_threads_unrounded();
 #else
     const size_t num_threads = 1;
 #endif
@@ -29,7 +30,21 @@ template <typename T> inline size_t point_table_buf_size(size_t num_points)
 
 template <typename T> inline T* point_table_alloc(size_t num_points)
 {
-    return (T*)aligned_alloc(64, point_table_buf_size<T>(num_points));
+    const size_t buf_size = point_table_buf_size<T>(num_points);
+    T* table = (T*)aligned_alloc(64, buf_size);
+
+    // Every pippenger thread reads points from the whole table, so no NUMA node is 'local' to it. Touch the pages from
+    // all threads, so that a first-touch policy spreads the table over the nodes instead of placing all of it on the
+    // node of the allocating thread.
+    const size_t num_threads = max_threads::compute_num_threads_unrounded();
+#ifndef NO_MULTITHREADING
+#pragma omp parallel for
+#endif
+    for (size_t j = 0; j < num_threads; ++j) {
+        const auto [start, end] = max_threads::get_thread_range(buf_size, num_threads, j, 4096);
+        memset((void*)((char*)table + start), 0, end - start);
+    }
+    return table;
 }
 
 class Pippenger {
@@ -43,19 +58,39 @@ class Pippenger {
 
     Pippenger(uint8_t const* points, size_t num_points);
 
+    /**
+     * Load the first `num_points` points of the transcript in directory `path`. If the directory holds a point table
+     * cache for at least that many points (see point_table_cache.hpp), the table is mapped from it instead.
+     */
     Pippenger(std::string const& path, size_t num_points);
 
     ~Pippenger();
 
+    /**
+     * Opt-in: precompute the shifted copies of the point table used by `pippenger_fixed_base` (see fixed_base.hpp).
+     * Afterwards `pippenger_unsafe` runs a single bucket round per commitment, at the cost of ~R times the memory of
+     * the point table. If `cache_path` is non-empty, the table is loaded from that file if it was built for this SRS,
+     * and otherwise computed and written to it.
+     * Returns false, leaving the regular pippenger in use, if no table fits in `max_table_bytes` (see
+     * `get_fixed_base_window_bits`).
+     */
+    bool enable_fixed_base_table(std::string const& cache_path = "",
+                                 const size_t max_table_bytes = DEFAULT_MAX_FIXED_BASE_TABLE_BYTES);
+
     g1::element pippenger_unsafe(fr* scalars, size_t from, size_t range);
 
     g1::affine_element* get_point_table() const { return monomials_; }
 
     size_t get_num_points() const { return num_points_; }
 
+    fixed_base_table const& get_fixed_base_table() const { return fixed_base_table_; }
+
   private:
     g1::affine_element* monomials_;
     size_t num_points_;
+    // Size of the mapping holding monomials_ if it was mapped from a point table cache, or 0 if it was allocated.
+    size_t mapped_size_ = 0;
+    fixed_base_table fixed_base_table_;
 };
 
 } // namespace scalar_multiplication
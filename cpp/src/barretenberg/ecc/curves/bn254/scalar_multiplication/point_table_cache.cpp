@@ -0,0 +1,189 @@
+#ifndef __wasm__
+#include "./point_table_cache.hpp"
+#include "./pippenger.hpp"
+
+#include "barretenberg/common/throw_or_abort.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+namespace barretenberg {
+namespace scalar_multiplication {
+
+namespace {
+constexpr uint64_t POINT_TABLE_CACHE_MAGIC = 0x6262707463616368ULL;
+constexpr uint64_t POINT_TABLE_CACHE_VERSION = 1;
+constexpr size_t PAGE_SIZE = 4096;
+
+struct point_table_cache_header {
+    uint64_t magic;
+    uint64_t version;
+    uint64_t num_points;
+    uint64_t block_size;
+    // Offset of the point table from the start of the file, a multiple of PAGE_SIZE.
+    uint64_t table_offset;
+};
+
+size_t round_up_to_page(const size_t size)
+{
+    return (size + PAGE_SIZE - 1) & ~(PAGE_SIZE - 1);
+}
+
+size_t get_num_blocks(const size_t num_points)
+{
+    return (num_points + POINT_TABLE_CACHE_BLOCK_SIZE - 1) / POINT_TABLE_CACHE_BLOCK_SIZE;
+}
+
+/**
+ * Checksum of the table entries of points [block * POINT_TABLE_CACHE_BLOCK_SIZE, ...) up to `num_points`. Four
+ * independent multiply-xor lanes keep it at memory speed; the block index is mixed in, so that swapped blocks are
+ * caught.
+ **/
+uint64_t compute_block_checksum(const g1::affine_element* point_table, const size_t block, const size_t num_points)
+{
+    constexpr uint64_t PRIME = 0x100000001b3ULL;
+    const size_t start = block * POINT_TABLE_CACHE_BLOCK_SIZE;
+    const size_t end = std::min(start + POINT_TABLE_CACHE_BLOCK_SIZE, num_points);
+    const auto* words = reinterpret_cast<const uint64_t*>(point_table + 2 * start);
+    const size_t num_words = (end - start) * 2 * sizeof(g1::affine_element) / sizeof(uint64_t);
+
+    std::array<uint64_t, 4> lanes{ 0xcbf29ce484222325ULL, block, ~block, num_words };
+    for (size_t i = 0; i < num_words; i += 4) {
+        for (size_t j = 0; j < 4; ++j) {
+            lanes[j] = (lanes[j] ^ words[i + j]) * PRIME;
+        }
+    }
+    uint64_t result = lanes[0];
+    for (size_t j = 1; j < 4; ++j) {
+        result = ((result ^ (lanes[j] >> 29)) * PRIME) ^ lanes[j];
+    }
+    return result;
+}
+} // namespace
+
+std::string get_point_table_cache_path(std::string const& dir)
+{
+    return dir + "/point_table.dat";
+}
+
+void write_point_table_cache(std::string const& path, const g1::affine_element* point_table, const size_t num_points)
+{
+    const size_t num_blocks = get_num_blocks(num_points);
+    const point_table_cache_header header{ POINT_TABLE_CACHE_MAGIC,
+                                           POINT_TABLE_CACHE_VERSION,
+                                           num_points,
+                                           POINT_TABLE_CACHE_BLOCK_SIZE,
+                                           round_up_to_page(sizeof(header) + num_blocks * sizeof(uint64_t)) };
+
+    std::vector<uint64_t> checksums(num_blocks);
+#ifndef NO_MULTITHREADING
+#pragma omp parallel for
+#endif
+    for (size_t i = 0; i < num_blocks; ++i) {
+        checksums[i] = compute_block_checksum(point_table, i, num_points);
+    }
+
+    const std::string temp_path = path + ".tmp" + std::to_string(getpid());
+    {
+        std::ofstream file(temp_path, std::ofstream::binary);
+        file.write((char const*)&header, sizeof(header));
+        file.write((char const*)checksums.data(), (std::streamsize)(num_blocks * sizeof(uint64_t)));
+        const std::vector<char> padding(header.table_offset - sizeof(header) - num_blocks * sizeof(uint64_t), 0);
+        file.write(padding.data(), (std::streamsize)padding.size());
+        file.write((char const*)point_table, (std::streamsize)(2 * num_points * sizeof(g1::affine_element)));
+        if (!file) {
+            std::remove(temp_path.c_str());
+            throw_or_abort("Unable to write point table cache to " + temp_path);
+        }
+    }
+    if (std::rename(temp_path.c_str(), path.c_str()) != 0) {
+        std::remove(temp_path.c_str());
+        throw_or_abort("Unable to write point table cache to " + path + ": " + std::strerror(errno));
+    }
+}
+
+g1::affine_element* map_point_table_cache(std::string const& path, const size_t num_points, size_t& mapped_size)
+{
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return nullptr;
+    }
+    struct stat st;
+    point_table_cache_header header;
+    const bool valid_header =
+        num_points > 0 && fstat(fd, &st) == 0 && pread(fd, &header, sizeof(header), 0) == sizeof(header) &&
+        header.magic == POINT_TABLE_CACHE_MAGIC && header.version == POINT_TABLE_CACHE_VERSION &&
+        header.block_size == POINT_TABLE_CACHE_BLOCK_SIZE && header.num_points >= num_points &&
+        header.table_offset ==
+            round_up_to_page(sizeof(header) + get_num_blocks(header.num_points) * sizeof(uint64_t)) &&
+        static_cast<uint64_t>(st.st_size) == header.table_offset + 2 * header.num_points * sizeof(g1::affine_element);
+    if (!valid_header) {
+        close(fd);
+        return nullptr;
+    }
+
+    // Map whole checksum blocks, so that every mapped block can be verified.
+    const size_t num_blocks = get_num_blocks(num_points);
+    std::vector<uint64_t> checksums(num_blocks);
+    const auto checksums_size = static_cast<ssize_t>(num_blocks * sizeof(uint64_t));
+    const size_t num_mapped_points = std::min(num_blocks * POINT_TABLE_CACHE_BLOCK_SIZE, (size_t)header.num_points);
+    const size_t file_map_size = 2 * num_mapped_points * sizeof(g1::affine_element);
+    if (pread(fd, checksums.data(), (size_t)checksums_size, sizeof(header)) != checksums_size) {
+        close(fd);
+        return nullptr;
+    }
+
+    // Reserve zeroed memory for the table and its overflow, then map the file over the front of it. The mapping is
+    // private, so that writes to the table (there should be none) never reach the file.
+    mapped_size = round_up_to_page(std::max(file_map_size, point_table_buf_size<g1::affine_element>(num_points)));
+    void* table =
+        mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (table == MAP_FAILED) {
+        close(fd);
+        return nullptr;
+    }
+    void* file_table = mmap(table,
+                            file_map_size,
+                            PROT_READ | PROT_WRITE,
+                            MAP_PRIVATE | MAP_FIXED,
+                            fd,
+                            static_cast<off_t>(header.table_offset));
+    // The mapping stays valid after the descriptor is closed.
+    close(fd);
+    if (file_table == MAP_FAILED) {
+        munmap(table, mapped_size);
+        return nullptr;
+    }
+
+    auto* point_table = static_cast<g1::affine_element*>(table);
+    std::vector<uint64_t> mapped_checksums(num_blocks);
+#ifndef NO_MULTITHREADING
+#pragma omp parallel for
+#endif
+    for (size_t i = 0; i < num_blocks; ++i) {
+        mapped_checksums[i] = compute_block_checksum(point_table, i, num_mapped_points);
+    }
+    if (mapped_checksums != checksums) {
+        munmap(table, mapped_size);
+        return nullptr;
+    }
+    return point_table;
+}
+
+void unmap_point_table_cache(g1::affine_element* point_table, const size_t mapped_size)
+{
+    munmap((void*)point_table, mapped_size);
+}
+
+} // namespace scalar_multiplication
+} // namespace barretenberg
+#endif
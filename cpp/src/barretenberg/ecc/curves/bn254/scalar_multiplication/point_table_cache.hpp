@@ -0,0 +1,49 @@
+#pragma once
+#ifndef __wasm__
+#include "./scalar_multiplication.hpp"
+#include <string>
+
+namespace barretenberg {
+namespace scalar_multiplication {
+
+/**
+ * A cache of the pippenger point table of an SRS, so that a prover can map it instead of reading the transcript.
+ *
+ * Reading the transcript byteswaps every point, converts it to Montgomery form and then expands it into the
+ * endomorphism table with `generate_pippenger_point_table`. The cache holds the expanded table exactly as it sits in
+ * memory, so loading it is a single mmap: pages are read on first use and shared between processes through the page
+ * cache.
+ *
+ * Layout: a header, one checksum per block of POINT_TABLE_CACHE_BLOCK_SIZE points, then (at a page boundary) the
+ * 2 * num_points entries of the point table. Each block's checksum is verified when it is first mapped, which detects
+ * truncated and corrupt files (it is not a cryptographic check: the cache is trusted as much as the transcript it was
+ * built from). A cache built for N points serves any number of points up to N.
+ *
+ * Fields are stored in Montgomery form and native byte order; POINT_TABLE_CACHE_VERSION must be bumped if either the
+ * table layout or the field representation changes.
+ **/
+constexpr size_t POINT_TABLE_CACHE_BLOCK_SIZE = 1UL << 16;
+
+/**
+ * The path of the point table cache of the transcript directory `dir`, which `Pippenger` looks for.
+ **/
+std::string get_point_table_cache_path(std::string const& dir);
+
+/**
+ * Write the point table (see `generate_pippenger_point_table`) of the first `num_points` points of an SRS to `path`.
+ * The file is written next to `path` and then renamed over it.
+ **/
+void write_point_table_cache(std::string const& path, const g1::affine_element* point_table, const size_t num_points);
+
+/**
+ * Map the point table of the first `num_points` points from the cache at `path`, followed by the zeroed overflow
+ * `point_table_size` asks for. Returns nullptr if the file is missing, holds fewer points or fails its checksums.
+ * On success, free the table with `unmap_point_table_cache(table, mapped_size)`.
+ **/
+g1::affine_element* map_point_table_cache(std::string const& path, const size_t num_points, size_t& mapped_size);
+
+void unmap_point_table_cache(g1::affine_element* point_table, const size_t mapped_size);
+
+} // namespace scalar_multiplication
+} // namespace barretenberg
+#endif
@@ -4,6 +4,8 @@
 #include "barretenberg/common/max_threads.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 
+#include <algorithm>
+
 #ifndef NO_MULTITHREADING
 #include <omp.h>
 #endif
@@ -16,18 +18,27 @@ pippenger_runtime_state::pippenger_runtime_state(const size_t num_initial_points
     constexpr size_t MAX_NUM_ROUNDS = 256;
     num_points = num_initial_points * 2;
     const size_t num_points_floor = static_cast<size_t>(1ULL << (numeric::get_msb(num_points)));
-    const size_t num_buckets = static_cast<size_t>(
-        1U << barretenberg::scalar_multiplication::get_optimal_bucket_width(static_cast<size_t>(num_initial_points)));
 #ifndef NO_MULTITHREADING
-    const size_t num_threads = max_threads::compute_num_threads();
+    const size_t num_threads = max_threads::compute_num_threads_unrounded();
 #else
     const size_t num_threads = 1;
 #endif
     const size_t prefetch_overflow = 16 * num_threads;
     const size_t num_rounds =
         static_cast<size_t>(barretenberg::scalar_multiplication::get_num_rounds(static_cast<size_t>(num_points_floor)));
-    point_schedule = (uint64_t*)(aligned_alloc(
-        64, (static_cast<size_t>(num_points) * num_rounds + prefetch_overflow) * sizeof(uint64_t)));
+
+    // `pippenger` evaluates power-of-two slices of the input, each with its own bucket width. A tuned bucket width
+    // profile does not have to be monotonic in the number of points, so size the schedule and bucket buffers for the
+    // most demanding slice rather than the largest one.
+    size_t max_bucket_width = get_optimal_bucket_width(static_cast<size_t>(num_initial_points));
+    size_t schedule_size = static_cast<size_t>(num_points) * num_rounds;
+    for (size_t slice_points = num_points_floor; slice_points > 1; slice_points >>= 1) {
+        max_bucket_width = std::max(max_bucket_width, get_optimal_bucket_width(slice_points / 2));
+        schedule_size = std::max(schedule_size, slice_points * get_num_rounds(slice_points));
+    }
+    num_buckets = static_cast<uint64_t>(1ULL << max_bucket_width);
+
+    point_schedule = (uint64_t*)(aligned_alloc(64, (schedule_size + prefetch_overflow) * sizeof(uint64_t)));
     skew_table = (bool*)(aligned_alloc(64, pad(static_cast<size_t>(num_points) * sizeof(bool), 64)));
     point_pairs_1 = (g1::affine_element*)(aligned_alloc(
         64, (static_cast<size_t>(num_points) * 2 + (num_threads * 16)) * sizeof(g1::affine_element)));
@@ -39,12 +50,15 @@ pippenger_runtime_state::pippenger_runtime_state(const size_t num_initial_points
     bucket_empty_status = (bool*)(aligned_alloc(64, num_threads * num_buckets * sizeof(bool)));
     round_counts = (uint64_t*)(aligned_alloc(32, MAX_NUM_ROUNDS * sizeof(uint64_t)));
 
-    const size_t points_per_thread = static_cast<size_t>(num_points) / num_threads;
+    // Each thread zeroes the memory it will work on, so that under a first-touch NUMA policy its buckets and scratch
+    // space are allocated on its own node.
 #ifndef NO_MULTITHREADING
 #pragma omp parallel for
 #endif
     for (size_t i = 0; i < num_threads; ++i) {
-        const size_t thread_offset = i * points_per_thread;
+        const auto [thread_offset, thread_end] =
+            max_threads::get_thread_range(static_cast<size_t>(num_points), num_threads, i);
+        const size_t points_per_thread = thread_end - thread_offset;
         memset((void*)(point_pairs_1 + thread_offset + (i * 16)),
                0,
                (points_per_thread + 16) * sizeof(g1::affine_element));
@@ -57,11 +71,11 @@ pippenger_runtime_state::pippenger_runtime_state(const size_t num_initial_points
             memset((void*)(point_schedule + round_offset + thread_offset), 0, points_per_thread * sizeof(uint64_t));
         }
         memset((void*)(skew_table + thread_offset), 0, points_per_thread * sizeof(bool));
+        memset((void*)(bucket_counts + i * num_buckets), 0, num_buckets * sizeof(uint32_t));
+        memset((void*)(bit_counts + i * num_buckets), 0, num_buckets * sizeof(uint32_t));
+        memset((void*)(bucket_empty_status + i * num_buckets), 0, num_buckets * sizeof(bool));
     }
 
-    memset((void*)bucket_counts, 0, num_threads * num_buckets * sizeof(uint32_t));
-    memset((void*)bit_counts, 0, num_threads * num_buckets * sizeof(uint32_t));
-    memset((void*)bucket_empty_status, 0, num_threads * num_buckets * sizeof(bool));
     memset((void*)round_counts, 0, MAX_NUM_ROUNDS * sizeof(uint64_t));
 }
 
@@ -88,6 +102,7 @@ pippenger_runtime_state::pippenger_runtime_state(pippenger_runtime_state&& other
     other.round_counts = nullptr;
 
     num_points = other.num_points;
+    num_buckets = other.num_buckets;
 }
 
 pippenger_runtime_state& pippenger_runtime_state::operator=(pippenger_runtime_state&& other)
@@ -149,21 +164,21 @@ pippenger_runtime_state& pippenger_runtime_state::operator=(pippenger_runtime_st
     other.round_counts = nullptr;
 
     num_points = other.num_points;
+    num_buckets = other.num_buckets;
     return *this;
 }
 
 affine_product_runtime_state pippenger_runtime_state::get_affine_product_runtime_state(const size_t num_threads,
                                                                                        const size_t thread_index)
 {
-    const size_t points_per_thread = static_cast<size_t>(num_points / num_threads);
-    const size_t num_buckets = static_cast<size_t>(
-        1U << barretenberg::scalar_multiplication::get_optimal_bucket_width(static_cast<size_t>(num_points) / 2));
+    const size_t thread_offset =
+        max_threads::get_thread_range(static_cast<size_t>(num_points), num_threads, thread_index).start;
 
     scalar_multiplication::affine_product_runtime_state product_state;
 
-    product_state.point_pairs_1 = point_pairs_1 + (thread_index * points_per_thread) + (thread_index * 16);
-    product_state.point_pairs_2 = point_pairs_2 + (thread_index * points_per_thread) + (thread_index * 16);
-    product_state.scratch_space = scratch_space + (thread_index * (points_per_thread / 2));
+    product_state.point_pairs_1 = point_pairs_1 + thread_offset + (thread_index * 16);
+    product_state.point_pairs_2 = point_pairs_2 + thread_offset + (thread_index * 16);
+    product_state.scratch_space = scratch_space + (thread_offset / 2);
     product_state.bucket_counts = bucket_counts + (thread_index * (num_buckets));
     product_state.bit_offsets = bit_counts + (thread_index * (num_buckets));
     product_state.bucket_empty_status = bucket_empty_status + (thread_index * (num_buckets));
@@ -6,7 +6,11 @@ namespace barretenberg {
 // simple helper functions to retrieve pointers to pre-allocated memory for the scalar multiplication algorithm.
 // This is to eliminate page faults when allocating (and writing) to large tranches of memory.
 namespace scalar_multiplication {
-constexpr size_t get_optimal_bucket_width(const size_t num_points)
+/**
+ * Default pippenger bucket widths, tuned on an i7-8650U. Used whenever the loaded bucket width profile has no entry
+ * for the current thread count (see `bucket_width_profile.hpp`).
+ **/
+constexpr size_t get_default_bucket_width(const size_t num_points)
 {
     if (num_points >= 14617149) {
         return 21;
@@ -56,7 +60,9 @@ constexpr size_t get_optimal_bucket_width(const size_t num_points)
     return 1;
 }
 
-constexpr size_t get_num_rounds(const size_t num_points)
+size_t get_optimal_bucket_width(const size_t num_points);
+
+inline size_t get_num_rounds(const size_t num_points)
 {
     const size_t bits_per_bucket = get_optimal_bucket_width(num_points / 2);
     return WNAF_SIZE(bits_per_bucket + 1);
@@ -86,6 +92,7 @@ struct pippenger_runtime_state {
     bool* bucket_empty_status;
     uint64_t* round_counts;
     uint64_t num_points;
+    uint64_t num_buckets;
 
     pippenger_runtime_state(const size_t num_initial_points);
     pippenger_runtime_state(pippenger_runtime_state&& other);
@@ -1,14 +1,17 @@
 #include "./scalar_multiplication.hpp"
 
+#include "barretenberg/common/assert.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/common/mem.hpp"
 #include "barretenberg/common/max_threads.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
+#include <map>
 
 #include "../../../groups/wnaf.hpp"
 #include "../fq.hpp"
@@ -200,32 +203,26 @@ void compute_wnaf_states(uint64_t* point_schedule,
 {
     const size_t num_points = num_initial_points * 2;
     constexpr size_t MAX_NUM_ROUNDS = 256;
-    constexpr size_t MAX_NUM_THREADS = 128;
     const size_t num_rounds = get_num_rounds(num_points);
     const size_t bits_per_bucket = get_optimal_bucket_width(num_initial_points);
     const size_t wnaf_bits = bits_per_bucket + 1;
 #ifndef NO_MULTITHREADING
-    const size_t num_threads = max_threads::compute_num_threads();
+    const size_t num_threads = max_threads::compute_num_threads_unrounded();
 #else
     const size_t num_threads = 1;
 #endif
-    const size_t num_initial_points_per_thread = num_initial_points / num_threads;
-    const size_t num_points_per_thread = num_points / num_threads;
-    std::array<std::array<uint64_t, MAX_NUM_ROUNDS>, MAX_NUM_THREADS> thread_round_counts;
-    for (size_t i = 0; i < num_threads; ++i) {
-        for (size_t j = 0; j < num_rounds; ++j) {
-            thread_round_counts[i][j] = 0;
-        }
-    }
+    std::vector<std::array<uint64_t, MAX_NUM_ROUNDS>> thread_round_counts(num_threads);
 #ifndef NO_MULTITHREADING
 #pragma omp parallel for
 #endif
     for (size_t i = 0; i < num_threads; ++i) {
         fr T0;
-        uint64_t* wnaf_table = &point_schedule[(2 * i) * num_initial_points_per_thread];
-        const fr* thread_scalars = &scalars[i * num_initial_points_per_thread];
-        bool* skew_table = &input_skew_table[(2 * i) * num_initial_points_per_thread];
-        uint64_t offset = i * num_points_per_thread;
+        const auto [thread_start, thread_end] = max_threads::get_thread_range(num_initial_points, num_threads, i);
+        const size_t num_initial_points_per_thread = thread_end - thread_start;
+        uint64_t* wnaf_table = &point_schedule[2 * thread_start];
+        const fr* thread_scalars = &scalars[thread_start];
+        bool* skew_table = &input_skew_table[2 * thread_start];
+        uint64_t offset = 2 * thread_start;
 
         for (uint64_t j = 0; j < num_initial_points_per_thread; ++j) {
             T0 = thread_scalars[j].from_montgomery_form();
@@ -258,6 +255,77 @@ void compute_wnaf_states(uint64_t* point_schedule,
     }
 }
 
+/**
+ * Compute signed-digit (Booth) versions of our scalar multipliers. See `wnaf::fixed_booth_with_counts`.
+ *
+ * This is the `RecodingMode::BOOTH` counterpart to `compute_wnaf_states`, and produces a point schedule in the same
+ * layout. The differences are that a zero digit removes the point from that round entirely, and that we never need to
+ * correct for a skew, so `input_skew_table` is cleared.
+ *
+ * @param point_schedule Pointer to the output array with all digits
+ * @param input_skew_table Pointer to the skew array, zeroed by this method
+ * @param round_counts The number of points in each round
+ * @param scalars The pointer to the region with initial scalars that need to be recoded
+ * @param num_initial_points The number of points before the endomorphism split
+ **/
+void compute_booth_states(uint64_t* point_schedule,
+                          bool* input_skew_table,
+                          uint64_t* round_counts,
+                          const fr* scalars,
+                          const size_t num_initial_points)
+{
+    const size_t num_points = num_initial_points * 2;
+    constexpr size_t MAX_NUM_ROUNDS = 256;
+    const size_t num_rounds = get_num_rounds(num_points);
+    const size_t bits_per_bucket = get_optimal_bucket_width(num_initial_points);
+    const size_t booth_bits = bits_per_bucket + 1;
+#ifndef NO_MULTITHREADING
+    const size_t num_threads = max_threads::compute_num_threads_unrounded();
+#else
+    const size_t num_threads = 1;
+#endif
+    std::vector<std::array<uint64_t, MAX_NUM_ROUNDS>> thread_round_counts(num_threads);
+#ifndef NO_MULTITHREADING
+#pragma omp parallel for
+#endif
+    for (size_t i = 0; i < num_threads; ++i) {
+        fr T0;
+        const auto [thread_start, thread_end] = max_threads::get_thread_range(num_initial_points, num_threads, i);
+        const size_t num_initial_points_per_thread = thread_end - thread_start;
+        uint64_t* booth_table = &point_schedule[2 * thread_start];
+        const fr* thread_scalars = &scalars[thread_start];
+        uint64_t offset = 2 * thread_start;
+
+        for (uint64_t j = 0; j < num_initial_points_per_thread; ++j) {
+            T0 = thread_scalars[j].from_montgomery_form();
+            fr::split_into_endomorphism_scalars(T0, T0, *(fr*)&T0.data[2]);
+
+            wnaf::fixed_booth_with_counts(&T0.data[0],
+                                          &booth_table[(j << 1UL)],
+                                          &thread_round_counts[i][0],
+                                          ((j << 1ULL) + offset) << 32ULL,
+                                          num_points,
+                                          booth_bits);
+            wnaf::fixed_booth_with_counts(&T0.data[2],
+                                          &booth_table[(j << 1UL) + 1],
+                                          &thread_round_counts[i][0],
+                                          ((j << 1UL) + offset + 1) << 32UL,
+                                          num_points,
+                                          booth_bits);
+        }
+        memset((void*)&input_skew_table[2 * thread_start], 0, 2 * num_initial_points_per_thread * sizeof(bool));
+    }
+
+    for (size_t i = 0; i < num_rounds; ++i) {
+        round_counts[i] = 0;
+    }
+    for (size_t i = 0; i < num_threads; ++i) {
+        for (size_t j = 0; j < num_rounds; ++j) {
+            round_counts[j] += thread_round_counts[i][j];
+        }
+    }
+}
+
 /**
  *  Sorts our wnaf entries in increasing bucket order (per round).
  *  We currently don't multi-thread the inner sorting algorithm, and just split our threads over the number of rounds.
@@ -311,38 +379,86 @@ void organize_buckets(uint64_t* point_schedule, const uint64_t*, const size_t nu
  **/
 void add_affine_points(g1::affine_element* points, const size_t num_points, fq* scratch_space)
 {
-    fq batch_inversion_accumulator = fq::one();
-
-    for (size_t i = 0; i < num_points; i += 2) {
-        scratch_space[i >> 1] = points[i].x + points[i + 1].x; // x2 + x1
-        points[i + 1].x -= points[i].x;                        // x2 - x1
-        points[i + 1].y -= points[i].y;                        // y2 - y1
-        points[i + 1].y *= batch_inversion_accumulator;        // (y2 - y1)*accumulator_old
-        batch_inversion_accumulator *= (points[i + 1].x);
+    // The batch inversion runs AFFINE_ADDITION_LANES independent accumulators over interleaved point pairs, so that
+    // each step is a `fq::mul_batch` over a chunk of pairs rather than a single chain of dependent multiplications.
+    // The accumulators are inverted together at the end of the forward pass.
+    constexpr size_t AFFINE_ADDITION_LANES = 8;
+    const size_t num_pairs = num_points >> 1;
+
+    std::array<fq, AFFINE_ADDITION_LANES> accumulators;
+    std::array<fq, AFFINE_ADDITION_LANES> x_diffs;
+    std::array<fq, AFFINE_ADDITION_LANES> y_diffs;
+    accumulators.fill(fq::one());
+
+    for (size_t pair = 0; pair < num_pairs; pair += AFFINE_ADDITION_LANES) {
+        const size_t num_lanes = std::min(AFFINE_ADDITION_LANES, num_pairs - pair);
+        std::span<fq> lanes{ &accumulators[0], num_lanes };
+        std::span<fq> dx{ &x_diffs[0], num_lanes };
+        std::span<fq> dy{ &y_diffs[0], num_lanes };
+        for (size_t j = 0; j < num_lanes; ++j) {
+            const size_t i = (pair + j) << 1;
+            scratch_space[i >> 1] = points[i].x + points[i + 1].x; // x2 + x1
+            dx[j] = points[i + 1].x - points[i].x;                 // x2 - x1
+            dy[j] = points[i + 1].y - points[i].y;                 // y2 - y1
+        }
+        fq::mul_batch(dy, lanes, dy); // (y2 - y1)*accumulator_old
+        fq::mul_batch(lanes, dx, lanes);
+        for (size_t j = 0; j < num_lanes; ++j) {
+            const size_t i = (pair + j) << 1;
+            points[i + 1].x = dx[j];
+            points[i + 1].y = dy[j];
+        }
     }
 
-    if (batch_inversion_accumulator == 0) {
-        throw_or_abort("attempted to invert zero in add_affine_points");
-    } else {
-        batch_inversion_accumulator = batch_inversion_accumulator.invert();
+    for (const auto& accumulator : accumulators) {
+        if (accumulator == 0) {
+            throw_or_abort("attempted to invert zero in add_affine_points");
+        }
     }
+    fq::batch_invert(std::span{ accumulators });
+
+    std::array<fq, AFFINE_ADDITION_LANES> lambdas;
+    std::array<fq, AFFINE_ADDITION_LANES> x_results;
+    std::array<fq, AFFINE_ADDITION_LANES> y_results;
+    std::array<fq, AFFINE_ADDITION_LANES> y_inputs;
+    // walk the chunks backwards, starting with the (possibly partial) last one
+    const size_t last_chunk = num_pairs == 0 ? 0 : ((num_pairs - 1) / AFFINE_ADDITION_LANES) * AFFINE_ADDITION_LANES;
+    for (size_t pair = last_chunk; pair < num_pairs; pair -= AFFINE_ADDITION_LANES) {
+        const size_t num_lanes = std::min(AFFINE_ADDITION_LANES, num_pairs - pair);
+        std::span<fq> lanes{ &accumulators[0], num_lanes };
+        std::span<fq> dx{ &x_diffs[0], num_lanes };
+        std::span<fq> dy{ &y_diffs[0], num_lanes };
+        std::span<fq> lambda{ &lambdas[0], num_lanes };
+        std::span<fq> x3{ &x_results[0], num_lanes };
+        std::span<fq> y3{ &y_results[0], num_lanes };
+        // Memory bandwidth is a bit of a bottleneck here, so fetch the next chunk while this one is processed
+        if (pair >= AFFINE_ADDITION_LANES) {
+            __builtin_prefetch(points + ((pair - AFFINE_ADDITION_LANES) << 1));
+            __builtin_prefetch(scratch_space + pair - AFFINE_ADDITION_LANES);
+        }
 
-    for (size_t i = (num_points)-2; i < num_points; i -= 2) {
-        // Memory bandwidth is a bit of a bottleneck here.
-        // There's probably a more elegant way of structuring our data so we don't need to do all of this prefetching
-        __builtin_prefetch(points + i - 2);
-        __builtin_prefetch(points + i - 1);
-        __builtin_prefetch(points + ((i + num_points - 2) >> 1));
-        __builtin_prefetch(scratch_space + ((i - 2) >> 1));
-
-        points[i + 1].y *= batch_inversion_accumulator; // update accumulator
-        batch_inversion_accumulator *= points[i + 1].x;
-        points[i + 1].x = points[i + 1].y.sqr();
-        points[(i + num_points) >> 1].x = points[i + 1].x - (scratch_space[i >> 1]); // x3 = lambda_squared - x2
-                                                                                     // - x1
-        points[i].x -= points[(i + num_points) >> 1].x;
-        points[i].x *= points[i + 1].y;
-        points[(i + num_points) >> 1].y = points[i].x - points[i].y;
+        for (size_t j = 0; j < num_lanes; ++j) {
+            const size_t i = (pair + j) << 1;
+            dx[j] = points[i + 1].x;
+            dy[j] = points[i + 1].y;
+        }
+        fq::mul_batch(dy, lanes, lambda); // lambda = (y2 - y1) / (x2 - x1)
+        fq::mul_batch(lanes, dx, lanes);  // update accumulator
+        fq::mul_batch(lambda, lambda, x3);
+        for (size_t j = 0; j < num_lanes; ++j) {
+            const size_t i = (pair + j) << 1;
+            x3[j] -= scratch_space[i >> 1]; // x3 = lambda_squared - x2 - x1
+            y3[j] = points[i].x - x3[j];
+            y_inputs[j] = points[i].y;
+        }
+        fq::mul_batch(y3, lambda, y3);
+        // The sum of pair i lands in slot (i + num_points) / 2 >= i. Every input of this chunk has been read by now,
+        // and later chunks only read lower indices, so the results can be written in place.
+        for (size_t j = 0; j < num_lanes; ++j) {
+            const size_t i = (pair + j) << 1;
+            points[(i + num_points) >> 1].x = x3[j];
+            points[(i + num_points) >> 1].y = y3[j] - y_inputs[j];
+        }
     }
 }
 
@@ -723,14 +839,85 @@ uint32_t construct_addition_chains(affine_product_runtime_state& state, bool emp
     return max_bucket_bits;
 }
 
-g1::element evaluate_pippenger_rounds(pippenger_runtime_state& state,
-                                      g1::affine_element* points,
-                                      const size_t num_points,
-                                      bool handle_edge_cases)
+/**
+ * Reduce a bucket-sorted slice of a point schedule into a single point, sum_k (weight_k * bucket_k).
+ *
+ * `state.point_schedule` must be sorted in increasing bucket order, and `state.points` / `state.num_points` describe
+ * the slice. The slice does not have to start at bucket 0: we scale the result up by the value of the first bucket.
+ * For wnaf digits bucket k has weight (2k + 1), for booth digits it has weight (k + 1).
+ **/
+g1::element accumulate_buckets(affine_product_runtime_state& state, bool handle_edge_cases, RecodingMode recoding)
+{
+    const bool booth = (recoding == RecodingMode::BOOTH);
+    const size_t first_bucket = state.point_schedule[0] & 0x7fffffffU;
+    const size_t last_bucket = state.point_schedule[state.num_points - 1] & 0x7fffffffU;
+    const size_t num_thread_buckets = (last_bucket - first_bucket) + 1;
+    state.num_buckets = static_cast<uint32_t>(num_thread_buckets);
+
+    g1::affine_element* output_buckets = reduce_buckets(state, true, handle_edge_cases);
+
+    g1::element accumulator;
+    accumulator.self_set_infinity();
+    g1::element running_sum;
+    running_sum.self_set_infinity();
+
+    // one nice side-effect of the affine trick, is that half of the bucket concatenation
+    // algorithm can use mixed addition formulae, instead of full addition formulae
+    size_t output_it = state.num_points - 1;
+    for (size_t k = num_thread_buckets - 1; k > 0; --k) {
+        if (__builtin_expect(!state.bucket_empty_status[k], 1)) {
+            running_sum += (output_buckets[output_it]);
+            --output_it;
+        }
+        accumulator += running_sum;
+    }
+    running_sum += output_buckets[0];
+    if (!booth) {
+        accumulator.self_dbl();
+    }
+    accumulator += running_sum;
+
+    // we now need to scale up 'running sum' up to the value of the first bucket.
+    // e.g. if first bucket is 0, no scaling
+    // if first bucket is 1, we need to add (2 * running_sum) (or (1 * running_sum) for booth digits)
+    if (first_bucket > 0) {
+        uint32_t multiplier = static_cast<uint32_t>(booth ? first_bucket : first_bucket << 1UL);
+        size_t shift = numeric::get_msb(multiplier);
+        g1::element rolling_accumulator = g1::point_at_infinity;
+        bool init = false;
+        while (shift != static_cast<size_t>(-1)) {
+            if (init) {
+                rolling_accumulator.self_dbl();
+                if (((multiplier >> shift) & 1)) {
+                    rolling_accumulator += running_sum;
+                }
+            } else {
+                rolling_accumulator += running_sum;
+            }
+            init = true;
+            shift -= 1;
+        }
+        accumulator += rolling_accumulator;
+    }
+    return accumulator;
+}
+
+/**
+ * Evaluate the rounds of a recoded and bucket-sorted point schedule.
+ *
+ * If `apply_skew_correction` is false the wnaf skew is left for the caller to subtract (see `pippenger_batch`, which
+ * corrects the skew of all of its scalar vectors in one pass over the point table).
+ **/
+static g1::element evaluate_rounds(pippenger_runtime_state& state,
+                                   g1::affine_element* points,
+                                   const size_t num_points,
+                                   bool handle_edge_cases,
+                                   RecodingMode recoding,
+                                   bool apply_skew_correction)
 {
     const size_t num_rounds = get_num_rounds(num_points);
 #ifndef NO_MULTITHREADING
-    const size_t num_threads = max_threads::compute_num_threads();
+    const size_t num_threads = max_threads::compute_num_threads_unrounded();
 #else
     const size_t num_threads = 1;
 #endif
@@ -752,73 +939,24 @@ g1::element evaluate_pippenger_rounds(pippenger_runtime_state& state,
             g1::element accumulator;
             accumulator.self_set_infinity();
 
-            if ((num_round_points == 0) || (num_round_points < num_threads && j != num_threads - 1)) {
-            } else {
-
-                const uint64_t num_round_points_per_thread = num_round_points / num_threads;
-                const uint64_t leftovers =
-                    (j == num_threads - 1) ? (num_round_points) - (num_round_points_per_thread * num_threads) : 0;
-
-                uint64_t* thread_point_schedule =
-                    &state.point_schedule[(i * num_points) + j * num_round_points_per_thread];
-                const size_t first_bucket = thread_point_schedule[0] & 0x7fffffffU;
-                const size_t last_bucket =
-                    thread_point_schedule[(num_round_points_per_thread - 1 + leftovers)] & 0x7fffffffU;
-                const size_t num_thread_buckets = (last_bucket - first_bucket) + 1;
-
+            // the round is split into num_threads ranges that differ in size by at most one point, so the thread
+            // count does not have to divide (or be a power of two)
+            const auto [round_start, round_end] =
+                max_threads::get_thread_range(static_cast<size_t>(num_round_points), num_threads, j);
+            if (round_end != round_start) {
                 affine_product_runtime_state product_state = state.get_affine_product_runtime_state(num_threads, j);
-                product_state.num_points = static_cast<uint32_t>(num_round_points_per_thread + leftovers);
+                product_state.num_points = static_cast<uint32_t>(round_end - round_start);
                 product_state.points = points;
-                product_state.point_schedule = thread_point_schedule;
-                product_state.num_buckets = static_cast<uint32_t>(num_thread_buckets);
-                g1::affine_element* output_buckets = reduce_buckets(product_state, true, handle_edge_cases);
-                g1::element running_sum;
-                running_sum.self_set_infinity();
-
-                // one nice side-effect of the affine trick, is that half of the bucket concatenation
-                // algorithm can use mixed addition formulae, instead of full addition formulae
-                size_t output_it = product_state.num_points - 1;
-                for (size_t k = num_thread_buckets - 1; k > 0; --k) {
-                    if (__builtin_expect(!product_state.bucket_empty_status[k], 1)) {
-                        running_sum += (output_buckets[output_it]);
-                        --output_it;
-                    }
-                    accumulator += running_sum;
-                }
-                running_sum += output_buckets[0];
-                accumulator.self_dbl();
-                accumulator += running_sum;
-
-                // we now need to scale up 'running sum' up to the value of the first bucket.
-                // e.g. if first bucket is 0, no scaling
-                // if first bucket is 1, we need to add (2 * running_sum)
-                if (first_bucket > 0) {
-                    uint32_t multiplier = static_cast<uint32_t>(first_bucket << 1UL);
-                    size_t shift = numeric::get_msb(multiplier);
-                    g1::element rolling_accumulator = g1::point_at_infinity;
-                    bool init = false;
-                    while (shift != static_cast<size_t>(-1)) {
-                        if (init) {
-                            rolling_accumulator.self_dbl();
-                            if (((multiplier >> shift) & 1)) {
-                                rolling_accumulator += running_sum;
-                            }
-                        } else {
-                            rolling_accumulator += running_sum;
-                        }
-                        init = true;
-                        shift -= 1;
-                    }
-                    accumulator += rolling_accumulator;
-                }
+                product_state.point_schedule = &state.point_schedule[(i * num_points) + round_start];
+                accumulator = accumulate_buckets(product_state, handle_edge_cases, recoding);
             }
 
-            if (i == (num_rounds - 1)) {
-                const size_t num_points_per_thread = num_points / num_threads;
-                bool* skew_table = &state.skew_table[j * num_points_per_thread];
-                g1::affine_element* point_table = &points[j * num_points_per_thread];
+            if (i == (num_rounds - 1) && apply_skew_correction) {
+                const auto [thread_start, thread_end] = max_threads::get_thread_range(num_points, num_threads, j);
+                bool* skew_table = &state.skew_table[thread_start];
+                g1::affine_element* point_table = &points[thread_start];
                 g1::affine_element addition_temporary;
-                for (size_t k = 0; k < num_points_per_thread; ++k) {
+                for (size_t k = 0; k < thread_end - thread_start; ++k) {
                     if (skew_table[k]) {
                         addition_temporary = -point_table[k];
                         accumulator += addition_temporary;
@@ -843,16 +981,31 @@ g1::element evaluate_pippenger_rounds(pippenger_runtime_state& state,
     return result;
 }
 
+g1::element evaluate_pippenger_rounds(pippenger_runtime_state& state,
+                                      g1::affine_element* points,
+                                      const size_t num_points,
+                                      bool handle_edge_cases,
+                                      RecodingMode recoding)
+{
+    return evaluate_rounds(state, points, num_points, handle_edge_cases, recoding, recoding == RecodingMode::WNAF);
+}
+
 g1::element pippenger_internal(g1::affine_element* points,
                                fr* scalars,
                                const size_t num_initial_points,
                                pippenger_runtime_state& state,
-                               bool handle_edge_cases)
+                               bool handle_edge_cases,
+                               RecodingMode recoding)
 {
     // multiplication_runtime_state state;
-    compute_wnaf_states(state.point_schedule, state.skew_table, state.round_counts, scalars, num_initial_points);
+    if (recoding == RecodingMode::BOOTH) {
+        compute_booth_states(state.point_schedule, state.skew_table, state.round_counts, scalars, num_initial_points);
+    } else {
+        compute_wnaf_states(state.point_schedule, state.skew_table, state.round_counts, scalars, num_initial_points);
+    }
     organize_buckets(state.point_schedule, state.round_counts, num_initial_points * 2);
-    g1::element result = evaluate_pippenger_rounds(state, points, num_initial_points * 2, handle_edge_cases);
+    g1::element result =
+        evaluate_pippenger_rounds(state, points, num_initial_points * 2, handle_edge_cases, recoding);
     return result;
 }
 
@@ -860,13 +1013,14 @@ g1::element pippenger(fr* scalars,
                       g1::affine_element* points,
                       const size_t num_initial_points,
                       pippenger_runtime_state& state,
-                      bool handle_edge_cases)
+                      bool handle_edge_cases,
+                      RecodingMode recoding)
 {
     // our windowed non-adjacent form algorthm requires that each thread can work on at least 8 points.
     // If we fall below this theshold, fall back to the traditional scalar multiplication algorithm.
     // For 8 threads, this neatly coincides with the threshold where Strauss scalar multiplication outperforms Pippenger
 #ifndef NO_MULTITHREADING
-    const size_t threshold = std::max(max_threads::compute_num_threads() * 8, 8UL);
+    const size_t threshold = std::max(max_threads::compute_num_threads_unrounded() * 8, 8UL);
 #else
     const size_t threshold = 8UL;
 #endif
@@ -897,7 +1051,7 @@ g1::element pippenger(fr* scalars,
     const size_t slice_bits = static_cast<size_t>(numeric::get_msb(static_cast<uint64_t>(num_initial_points)));
     const size_t num_slice_points = static_cast<size_t>(1ULL << slice_bits);
 
-    g1::element result = pippenger_internal(points, scalars, num_slice_points, state, handle_edge_cases);
+    g1::element result = pippenger_internal(points, scalars, num_slice_points, state, handle_edge_cases, recoding);
 
     if (num_slice_points != num_initial_points) {
         const uint64_t leftover_points = num_initial_points - num_slice_points;
@@ -905,7 +1059,8 @@ g1::element pippenger(fr* scalars,
                                   points + static_cast<size_t>(num_slice_points * 2),
                                   static_cast<size_t>(leftover_points),
                                   state,
-                                  handle_edge_cases);
+                                  handle_edge_cases,
+                                  recoding);
     } else {
         return result;
     }
@@ -929,10 +1084,148 @@ g1::element pippenger(fr* scalars,
 g1::element pippenger_unsafe(fr* scalars,
                              g1::affine_element* points,
                              const size_t num_initial_points,
-                             pippenger_runtime_state& state)
+                             pippenger_runtime_state& state,
+                             RecodingMode recoding)
+{
+    return pippenger(scalars, points, num_initial_points, state, false, recoding);
+}
+/**
+ * Run one wnaf pippenger per scalar vector over the same `2 * num_initial_points` point table, reusing `state`.
+ *
+ * The wnaf recoding, the bucket sort and every bucket round still run separately for each vector, so the bucket
+ * rounds load each point once per vector. Only the skew correction is shared: each vector gets its own skew table, and
+ * after all rounds have been evaluated we walk the point table once and subtract every skewed point from each of the
+ * vectors' results.
+ **/
+static std::vector<g1::element> pippenger_batch_internal(g1::affine_element* points,
+                                                         std::span<fr* const> scalars,
+                                                         const size_t num_initial_points,
+                                                         pippenger_runtime_state& state,
+                                                         bool handle_edge_cases)
+{
+    const size_t num_msms = scalars.size();
+    const size_t num_points = num_initial_points * 2;
+#ifndef NO_MULTITHREADING
+    const size_t num_threads = max_threads::compute_num_threads_unrounded();
+#else
+    const size_t num_threads = 1;
+#endif
+
+    const size_t skew_table_size = num_msms * num_points * sizeof(bool);
+    std::unique_ptr<bool[], decltype(&aligned_free)> skew_tables(
+        static_cast<bool*>(aligned_alloc(64, pad(skew_table_size, 64))), &aligned_free);
+
+    std::vector<g1::element> results(num_msms);
+    for (size_t k = 0; k < num_msms; ++k) {
+        bool* skew_table = &skew_tables[k * num_points];
+        compute_wnaf_states(state.point_schedule, skew_table, state.round_counts, scalars[k], num_initial_points);
+        organize_buckets(state.point_schedule, state.round_counts, num_points);
+        results[k] = evaluate_rounds(state, points, num_points, handle_edge_cases, RecodingMode::WNAF, false);
+    }
+
+    std::vector<g1::element> thread_corrections(num_threads * num_msms);
+#ifndef NO_MULTITHREADING
+#pragma omp parallel for
+#endif
+    for (size_t j = 0; j < num_threads; ++j) {
+        g1::element* corrections = &thread_corrections[j * num_msms];
+        for (size_t k = 0; k < num_msms; ++k) {
+            corrections[k].self_set_infinity();
+        }
+        const auto [start, end] = max_threads::get_thread_range(num_points, num_threads, j);
+        for (size_t i = start; i < end; ++i) {
+            const g1::affine_element negated_point = -points[i];
+            for (size_t k = 0; k < num_msms; ++k) {
+                if (skew_tables[k * num_points + i]) {
+                    corrections[k] += negated_point;
+                }
+            }
+        }
+    }
+
+    for (size_t j = 0; j < num_threads; ++j) {
+        for (size_t k = 0; k < num_msms; ++k) {
+            results[k] += thread_corrections[j * num_msms + k];
+        }
+    }
+    return results;
+}
+
+/**
+ * Compute K multi-scalar multiplications against one shared point table.
+ *
+ * This is a convenience wrapper rather than a shared pass over the points: the bucket rounds of each vector run one
+ * after the other, as `pippenger` would run them (see `pippenger_batch_internal`). It saves a runtime state per vector
+ * and a skew correction pass per vector, not the point loads of the rounds.
+ *
+ * `scalars[k]` holds `num_initial_points[k]` scalars and is multiplied against the first `num_initial_points[k]`
+ * points of `points` (an endomorphism-expanded table, see `generate_pippenger_point_table`). `state` must have been
+ * constructed for at least `max_k(num_initial_points[k])` points; it is reused by every vector in the batch.
+ *
+ * Like `pippenger`, each vector is split into a power-of-two slice plus a leftover tail. Vectors whose slices have the
+ * same size are evaluated together by `pippenger_batch_internal`, and their tails (e.g. the single extra coefficient
+ * of the n + 1 sized quotient commitments) are evaluated as a second batch over the following points.
+ *
+ * Results are identical to calling `pippenger` on each vector in turn.
+ **/
+std::vector<g1::element> pippenger_batch(std::span<fr* const> scalars,
+                                         std::span<const size_t> num_initial_points,
+                                         g1::affine_element* points,
+                                         pippenger_runtime_state& state,
+                                         bool handle_edge_cases)
 {
-    return pippenger(scalars, points, num_initial_points, state, false);
+    ASSERT(scalars.size() == num_initial_points.size());
+    const size_t num_msms = scalars.size();
+#ifndef NO_MULTITHREADING
+    const size_t threshold = std::max(max_threads::compute_num_threads_unrounded() * 8, 8UL);
+#else
+    const size_t threshold = 8UL;
+#endif
+
+    std::vector<g1::element> results(num_msms);
+    std::map<size_t, std::vector<size_t>> slices;
+    for (size_t k = 0; k < num_msms; ++k) {
+        if (num_initial_points[k] <= threshold) {
+            results[k] = pippenger(scalars[k], points, num_initial_points[k], state, handle_edge_cases);
+        } else {
+            results[k].self_set_infinity();
+            slices[numeric::get_msb(static_cast<uint64_t>(num_initial_points[k]))].push_back(k);
+        }
+    }
+
+    for (const auto& [slice_bits, msm_indices] : slices) {
+        const size_t num_slice_points = static_cast<size_t>(1ULL << slice_bits);
+
+        std::vector<fr*> slice_scalars;
+        for (const size_t k : msm_indices) {
+            slice_scalars.push_back(scalars[k]);
+        }
+        const std::vector<g1::element> slice_results =
+            pippenger_batch_internal(points, slice_scalars, num_slice_points, state, handle_edge_cases);
+
+        std::vector<fr*> tail_scalars;
+        std::vector<size_t> tail_sizes;
+        std::vector<size_t> tail_indices;
+        for (size_t i = 0; i < msm_indices.size(); ++i) {
+            const size_t k = msm_indices[i];
+            results[k] = slice_results[i];
+            if (num_initial_points[k] != num_slice_points) {
+                tail_scalars.push_back(scalars[k] + num_slice_points);
+                tail_sizes.push_back(num_initial_points[k] - num_slice_points);
+                tail_indices.push_back(k);
+            }
+        }
+        if (!tail_indices.empty()) {
+            const std::vector<g1::element> tail_results =
+                pippenger_batch(tail_scalars, tail_sizes, points + num_slice_points * 2, state, handle_edge_cases);
+            for (size_t i = 0; i < tail_indices.size(); ++i) {
+                results[tail_indices[i]] += tail_results[i];
+            }
+        }
+    }
+    return results;
 }
+
 g1::element pippenger_without_endomorphism_basis_points(fr* scalars,
                                                         g1::affine_element* points,
                                                         const size_t num_initial_points,
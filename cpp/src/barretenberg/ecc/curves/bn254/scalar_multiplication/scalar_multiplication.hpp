@@ -3,13 +3,15 @@
 #include "../fr.hpp"
 #include "../g1.hpp"
 #include "./runtime_states.hpp"
+#include <span>
 #include <stddef.h>
 #include <stdint.h>
+#include <vector>
 
 namespace barretenberg {
 namespace scalar_multiplication {
 
-constexpr size_t get_num_buckets(const size_t num_points)
+inline size_t get_num_buckets(const size_t num_points)
 {
     const size_t bits_per_bucket = get_optimal_bucket_width(num_points / 2);
     return 1UL << bits_per_bucket;
@@ -80,6 +82,17 @@ constexpr size_t get_num_buckets(const size_t num_points)
  *
  **/
 
+/**
+ * How scalar multipliers are sliced into bucket indices.
+ *
+ * WNAF: odd digits in (-2^{b+1}, 2^{b+1}) plus a skew bit per scalar, corrected for at the end of the final round.
+ * BOOTH: signed digits in [-2^{b}, 2^{b}]. Zero digits are skipped rather than added into a bucket, and there is no
+ *        skew correction pass. Both recodings use 2^b buckets for a (b+1)-bit window.
+ *
+ * Both modes accumulate buckets with the affine addition chains in `reduce_buckets`.
+ **/
+enum class RecodingMode { WNAF, BOOTH };
+
 struct multiplication_thread_state {
     g1::element* buckets;
     const uint64_t* point_schedule;
@@ -91,6 +104,12 @@ void compute_wnaf_states(uint64_t* point_schedule,
                          const fr* scalars,
                          const size_t num_initial_points);
 
+void compute_booth_states(uint64_t* point_schedule,
+                          bool* input_skew_table,
+                          uint64_t* round_counts,
+                          const fr* scalars,
+                          const size_t num_initial_points);
+
 void generate_pippenger_point_table(g1::affine_element* points, g1::affine_element* table, size_t num_points);
 
 void organize_buckets(uint64_t* point_schedule, const uint64_t* round_counts, const size_t num_points);
@@ -121,16 +140,22 @@ void evaluate_addition_chains(affine_product_runtime_state& state,
                               const size_t max_bucket_bits,
                               bool handle_edge_cases);
 
+g1::element accumulate_buckets(affine_product_runtime_state& state,
+                               bool handle_edge_cases,
+                               RecodingMode recoding = RecodingMode::WNAF);
+
 g1::element pippenger_internal(g1::affine_element* points,
                                fr* scalars,
                                const size_t num_initial_points,
                                pippenger_runtime_state& state,
-                               bool handle_edge_cases);
+                               bool handle_edge_cases,
+                               RecodingMode recoding = RecodingMode::WNAF);
 
 g1::element evaluate_pippenger_rounds(pippenger_runtime_state& state,
                                       g1::affine_element* points,
                                       const size_t num_points,
-                                      bool handle_edge_cases = false);
+                                      bool handle_edge_cases = false,
+                                      RecodingMode recoding = RecodingMode::WNAF);
 
 g1::affine_element* reduce_buckets(affine_product_runtime_state& state,
                                    bool first_round = true,
@@ -140,12 +165,20 @@ g1::element pippenger(fr* scalars,
                       g1::affine_element* points,
                       const size_t num_points,
                       pippenger_runtime_state& state,
-                      bool handle_edge_cases = true);
+                      bool handle_edge_cases = true,
+                      RecodingMode recoding = RecodingMode::WNAF);
 
 g1::element pippenger_unsafe(fr* scalars,
                              g1::affine_element* points,
                              const size_t num_initial_points,
-                             pippenger_runtime_state& state);
+                             pippenger_runtime_state& state,
+                             RecodingMode recoding = RecodingMode::WNAF);
+std::vector<g1::element> pippenger_batch(std::span<fr* const> scalars,
+                                         std::span<const size_t> num_initial_points,
+                                         g1::affine_element* points,
+                                         pippenger_runtime_state& state,
+                                         bool handle_edge_cases = false);
+
 g1::element pippenger_without_endomorphism_basis_points(fr* scalars,
                                                         g1::affine_element* points,
                                                         const size_t num_initial_points,
@@ -1,14 +1,25 @@
 #include "pippenger.hpp"
+#include "bucket_width_profile.hpp"
+#include "fixed_base.hpp"
+#include "point_table_cache.hpp"
 #include "scalar_multiplication.hpp"
 #include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <unistd.h>
 #include "barretenberg/common/test.hpp"
 #include "barretenberg/srs/io.hpp"
 #include <vector>
 
 #include "barretenberg/numeric/random/engine.hpp"
 
+#include "barretenberg/common/max_threads.hpp"
 #include "barretenberg/common/mem.hpp"
 
+#ifndef NO_MULTITHREADING
+#include <omp.h>
+#endif
+
 #define BARRETENBERG_SRS_PATH "../srs_db/ignition"
 
 using namespace barretenberg;
@@ -539,7 +550,7 @@ TEST(scalar_multiplication, radix_sort)
 {
     // check that our radix sort correctly sorts!
     constexpr size_t target_degree = 1 << 8;
-    constexpr size_t num_rounds = scalar_multiplication::get_num_rounds(target_degree * 2);
+    const size_t num_rounds = scalar_multiplication::get_num_rounds(target_degree * 2);
     fr* scalars = (fr*)(aligned_alloc(64, sizeof(fr) * target_degree));
 
     fr source_scalar = fr::random_element();
@@ -869,6 +880,363 @@ TEST(scalar_multiplication, pippenger_unsafe_short_inputs)
     EXPECT_EQ(result == expected, true);
 }
 
+TEST(scalar_multiplication, pippenger_unsafe_booth)
+{
+    // not a power of two, so that we also recurse into `pippenger` for the leftover points
+    constexpr size_t num_points = 8192 + 1000;
+
+    fr* scalars = (fr*)aligned_alloc(32, sizeof(fr) * num_points);
+
+    g1::affine_element* points = scalar_multiplication::point_table_alloc<g1::affine_element>(num_points);
+
+    for (size_t i = 0; i < num_points; ++i) {
+        scalars[i] = fr::random_element();
+        points[i] = g1::affine_element(g1::element::random_element());
+    }
+
+    g1::element expected;
+    expected.self_set_infinity();
+    for (size_t i = 0; i < num_points; ++i) {
+        g1::element temp = points[i] * scalars[i];
+        expected += temp;
+    }
+    expected = expected.normalize();
+    scalar_multiplication::generate_pippenger_point_table(points, points, num_points);
+
+    scalar_multiplication::pippenger_runtime_state state(num_points);
+    g1::element result = scalar_multiplication::pippenger_unsafe(
+        scalars, points, num_points, state, scalar_multiplication::RecodingMode::BOOTH);
+    result = result.normalize();
+
+    aligned_free(scalars);
+    aligned_free(points);
+
+    EXPECT_EQ(result == expected, true);
+}
+
+TEST(scalar_multiplication, pippenger_booth_short_inputs)
+{
+    constexpr size_t num_points = 8192;
+
+    fr* scalars = (fr*)aligned_alloc(32, sizeof(fr) * num_points);
+
+    g1::affine_element* points = scalar_multiplication::point_table_alloc<g1::affine_element>(num_points);
+
+    for (size_t i = 0; i < num_points; ++i) {
+        points[i] = g1::affine_element(g1::element::random_element());
+    }
+    for (size_t i = 0; i < (num_points / 4); ++i) {
+        scalars[i * 4].data[0] = engine.get_random_uint32();
+        scalars[i * 4].data[1] = engine.get_random_uint32();
+        scalars[i * 4].data[2] = engine.get_random_uint32();
+        scalars[i * 4].data[3] = engine.get_random_uint32();
+        scalars[i * 4] = scalars[i * 4].to_montgomery_form();
+        scalars[i * 4 + 1].data[0] = 0;
+        scalars[i * 4 + 1].data[1] = 0;
+        scalars[i * 4 + 1].data[2] = 0;
+        scalars[i * 4 + 1].data[3] = 0;
+        scalars[i * 4 + 1] = scalars[i * 4 + 1].to_montgomery_form();
+        scalars[i * 4 + 2].data[0] = engine.get_random_uint32();
+        scalars[i * 4 + 2].data[1] = engine.get_random_uint32();
+        scalars[i * 4 + 2].data[2] = 0;
+        scalars[i * 4 + 2].data[3] = 0;
+        scalars[i * 4 + 2] = scalars[i * 4 + 2].to_montgomery_form();
+        scalars[i * 4 + 3].data[0] = (engine.get_random_uint32() & 0x07ULL);
+        scalars[i * 4 + 3].data[1] = 0;
+        scalars[i * 4 + 3].data[2] = 0;
+        scalars[i * 4 + 3].data[3] = 0;
+        scalars[i * 4 + 3] = scalars[i * 4 + 3].to_montgomery_form();
+    }
+
+    g1::element expected;
+    expected.self_set_infinity();
+    for (size_t i = 0; i < num_points; ++i) {
+        g1::element temp = points[i] * scalars[i];
+        expected += temp;
+    }
+    expected = expected.normalize();
+    scalar_multiplication::generate_pippenger_point_table(points, points, num_points);
+    scalar_multiplication::pippenger_runtime_state state(num_points);
+
+    g1::element result = scalar_multiplication::pippenger(
+        scalars, points, num_points, state, true, scalar_multiplication::RecodingMode::BOOTH);
+    result = result.normalize();
+
+    aligned_free(scalars);
+    aligned_free(points);
+
+    EXPECT_EQ(result == expected, true);
+}
+
+TEST(scalar_multiplication, pippenger_fixed_base)
+{
+    constexpr size_t num_points = 4096;
+    constexpr size_t offset = 1000;
+    constexpr size_t num_msm_points = 2000;
+
+    fr* scalars = (fr*)aligned_alloc(32, sizeof(fr) * num_msm_points);
+
+    g1::affine_element* points = scalar_multiplication::point_table_alloc<g1::affine_element>(num_points);
+
+    for (size_t i = 0; i < num_points; ++i) {
+        points[i] = g1::affine_element(g1::element::random_element());
+    }
+    for (size_t i = 0; i < num_msm_points; ++i) {
+        scalars[i] = fr::random_element();
+    }
+    // exercise zero digits and short scalars
+    scalars[0] = fr::zero();
+    scalars[1] = fr(7);
+
+    g1::element expected;
+    expected.self_set_infinity();
+    for (size_t i = 0; i < num_msm_points; ++i) {
+        g1::element temp = points[offset + i] * scalars[i];
+        expected += temp;
+    }
+    expected = expected.normalize();
+    scalar_multiplication::generate_pippenger_point_table(points, points, num_points);
+
+    scalar_multiplication::fixed_base_table table(points, num_points);
+    EXPECT_EQ(table.num_rounds, WNAF_SIZE(table.window_bits));
+
+    g1::element result = scalar_multiplication::pippenger_fixed_base(scalars, table, offset, num_msm_points);
+    result = result.normalize();
+    EXPECT_EQ(result == expected, true);
+
+    // round trip the table through a cache file
+    const std::string cache_path = "pippenger_fixed_base_table.test.dat";
+    scalar_multiplication::write_fixed_base_table(cache_path, table);
+    scalar_multiplication::fixed_base_table loaded;
+    EXPECT_EQ(scalar_multiplication::read_fixed_base_table(cache_path, loaded, points, num_points), true);
+    EXPECT_EQ(scalar_multiplication::read_fixed_base_table(cache_path, loaded, points, num_points / 2), false);
+    std::remove(cache_path.c_str());
+
+    result = scalar_multiplication::pippenger_fixed_base(scalars, loaded, offset, num_msm_points);
+    result = result.normalize();
+    EXPECT_EQ(result == expected, true);
+
+    aligned_free(scalars);
+    aligned_free(points);
+}
+
+TEST(scalar_multiplication, fixed_base_table_memory_cap)
+{
+    constexpr size_t num_points = 4096;
+    constexpr size_t round_bytes = 2 * num_points * sizeof(g1::affine_element);
+
+    // The fastest window (13 bits, 10 rounds) is taken when it fits; tighter caps take larger windows, down to 6
+    // rounds of 22 bits, and below that no window fits.
+    EXPECT_EQ(scalar_multiplication::get_fixed_base_window_bits(num_points), 13UL);
+    EXPECT_EQ(scalar_multiplication::get_fixed_base_window_bits(num_points, 9 * round_bytes), 15UL);
+    EXPECT_EQ(scalar_multiplication::get_fixed_base_window_bits(num_points, 6 * round_bytes), 22UL);
+    EXPECT_EQ(scalar_multiplication::get_fixed_base_window_bits(num_points, 6 * round_bytes - 1), 0UL);
+    EXPECT_EQ(scalar_multiplication::get_fixed_base_table_bytes(num_points, 15), 9 * round_bytes);
+
+    // The fastest table for 2^22 points takes 3GiB, over the default cap.
+    EXPECT_EQ(scalar_multiplication::get_fixed_base_window_bits(1UL << 22), 0UL);
+    EXPECT_EQ(scalar_multiplication::get_fixed_base_window_bits(1UL << 22, 6 * (1UL << 29)), 22UL);
+
+    g1::affine_element* points = scalar_multiplication::point_table_alloc<g1::affine_element>(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        points[i] = g1::affine_element(g1::element::random_element());
+    }
+    scalar_multiplication::generate_pippenger_point_table(points, points, num_points);
+
+    // A capped table still computes the same multi-scalar multiplication.
+    constexpr size_t num_msm_points = 1000;
+    std::vector<fr> scalars(num_msm_points);
+    for (auto& scalar : scalars) {
+        scalar = fr::random_element();
+    }
+    scalar_multiplication::fixed_base_table table(points, num_points);
+    scalar_multiplication::fixed_base_table capped_table(points, num_points, 9 * round_bytes);
+    EXPECT_EQ(capped_table.window_bits, 15UL);
+    EXPECT_EQ(capped_table.get_num_table_points() * sizeof(g1::affine_element), 9 * round_bytes);
+    const g1::element expected = scalar_multiplication::pippenger_fixed_base(&scalars[0], table, 0, num_msm_points);
+    const g1::element result =
+        scalar_multiplication::pippenger_fixed_base(&scalars[0], capped_table, 0, num_msm_points);
+    EXPECT_EQ(result.normalize() == expected.normalize(), true);
+
+    EXPECT_THROW(scalar_multiplication::fixed_base_table(points, num_points, 6 * round_bytes - 1), std::runtime_error);
+
+    aligned_free(points);
+}
+
+TEST(scalar_multiplication, point_table_cache)
+{
+    // Two checksum blocks, the second one partial.
+    constexpr size_t num_points = POINT_TABLE_CACHE_BLOCK_SIZE + 1000;
+    const auto dir = std::filesystem::temp_directory_path() / ("point_table_cache_" + std::to_string(getpid()));
+    std::filesystem::create_directories(dir);
+    const std::string cache_path = get_point_table_cache_path(dir.string());
+
+    std::vector<g1::element> elements(num_points);
+    elements[0] = g1::element::random_element();
+    for (size_t i = 1; i < num_points; ++i) {
+        elements[i] = elements[i - 1] + elements[0];
+    }
+    g1::element::batch_normalize(&elements[0], num_points);
+    g1::affine_element* points = point_table_alloc<g1::affine_element>(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        points[i] = g1::affine_element(elements[i].x, elements[i].y);
+    }
+    generate_pippenger_point_table(points, points, num_points);
+    write_point_table_cache(cache_path, points, num_points);
+
+    // There is no transcript in `dir`: Pippenger can only have read the cache.
+    for (const size_t num_loaded_points : { num_points, (size_t)100 }) {
+        Pippenger pippenger(dir.string(), num_loaded_points);
+        EXPECT_EQ(memcmp((void*)pippenger.get_point_table(),
+                         (void*)points,
+                         2 * num_loaded_points * sizeof(g1::affine_element)),
+                  0);
+    }
+    size_t mapped_size = 0;
+    EXPECT_EQ(map_point_table_cache(cache_path, num_points + 1, mapped_size), nullptr);
+
+    // Corrupt a point of the second block: only loads that map the second block notice.
+    {
+        std::fstream file(cache_path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekg(-1, std::ios::end);
+        const auto byte = static_cast<char>(~file.get());
+        file.seekp(-1, std::ios::end);
+        file.put(byte);
+    }
+    EXPECT_EQ(map_point_table_cache(cache_path, num_points, mapped_size), nullptr);
+    auto* mapped = map_point_table_cache(cache_path, 100, mapped_size);
+    ASSERT_NE(mapped, nullptr);
+    EXPECT_EQ(memcmp((void*)mapped, (void*)points, 200 * sizeof(g1::affine_element)), 0);
+    unmap_point_table_cache(mapped, mapped_size);
+
+    std::filesystem::remove_all(dir);
+    aligned_free(points);
+}
+
+TEST(scalar_multiplication, pippenger_batch)
+{
+    // mix of slice sizes, leftover tails and a vector small enough to skip pippenger altogether
+    const std::vector<size_t> msm_sizes{ 4096, 4097, 4096, 4096 + 1000, 3000, 5 };
+    constexpr size_t num_points = 4096 + 1000;
+
+    g1::affine_element* points = scalar_multiplication::point_table_alloc<g1::affine_element>(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        points[i] = g1::affine_element(g1::element::random_element());
+    }
+    scalar_multiplication::generate_pippenger_point_table(points, points, num_points);
+
+    std::vector<std::vector<fr>> scalar_vectors;
+    std::vector<fr*> scalars;
+    for (const size_t msm_size : msm_sizes) {
+        std::vector<fr> scalar_vector(msm_size);
+        for (auto& scalar : scalar_vector) {
+            scalar = fr::random_element();
+        }
+        scalar_vectors.emplace_back(std::move(scalar_vector));
+        scalars.push_back(scalar_vectors.back().data());
+    }
+
+    scalar_multiplication::pippenger_runtime_state state(num_points);
+    std::vector<g1::element> results = scalar_multiplication::pippenger_batch(scalars, msm_sizes, points, state);
+
+    EXPECT_EQ(results.size(), msm_sizes.size());
+    for (size_t k = 0; k < msm_sizes.size(); ++k) {
+        g1::element expected = scalar_multiplication::pippenger_unsafe(scalars[k], points, msm_sizes[k], state);
+        EXPECT_EQ(results[k].normalize() == expected.normalize(), true);
+    }
+
+    aligned_free(points);
+}
+
+TEST(scalar_multiplication, pippenger_bucket_width_profile)
+{
+    // not a power of two, so that the leftover slice picks up a different profile entry
+    constexpr size_t num_points = 4096 + 1000;
+    const size_t num_threads = max_threads::compute_num_threads_unrounded();
+
+    fr* scalars = (fr*)aligned_alloc(32, sizeof(fr) * num_points);
+    g1::affine_element* points = scalar_multiplication::point_table_alloc<g1::affine_element>(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        scalars[i] = fr::random_element();
+        points[i] = g1::affine_element(g1::element::random_element());
+    }
+    scalar_multiplication::generate_pippenger_point_table(points, points, num_points);
+
+    g1::element expected;
+    {
+        scalar_multiplication::pippenger_runtime_state state(num_points);
+        expected = scalar_multiplication::pippenger_unsafe(scalars, points, num_points, state);
+    }
+
+    // deliberately non-monotonic: the smaller slice uses a wider window than the larger one
+    scalar_multiplication::set_bucket_width(num_threads, 256, 12);
+    scalar_multiplication::set_bucket_width(num_threads, 4096, 5);
+    EXPECT_EQ(scalar_multiplication::get_optimal_bucket_width(100),
+              scalar_multiplication::get_default_bucket_width(100));
+    EXPECT_EQ(scalar_multiplication::get_optimal_bucket_width(1000), 12UL);
+    EXPECT_EQ(scalar_multiplication::get_optimal_bucket_width(5096), 5UL);
+
+    const std::string profile_path = "pippenger_bucket_width_profile.test.txt";
+    scalar_multiplication::save_bucket_width_profile(profile_path);
+    scalar_multiplication::clear_bucket_width_profile();
+    EXPECT_EQ(scalar_multiplication::get_optimal_bucket_width(1000),
+              scalar_multiplication::get_default_bucket_width(1000));
+    EXPECT_EQ(scalar_multiplication::load_bucket_width_profile(profile_path), true);
+    EXPECT_EQ(scalar_multiplication::get_bucket_width_profile().size(), 2UL);
+    std::remove(profile_path.c_str());
+
+    g1::element result;
+    {
+        scalar_multiplication::pippenger_runtime_state state(num_points);
+        result = scalar_multiplication::pippenger_unsafe(scalars, points, num_points, state);
+    }
+    scalar_multiplication::clear_bucket_width_profile();
+
+    aligned_free(scalars);
+    aligned_free(points);
+
+    EXPECT_EQ(result.normalize() == expected.normalize(), true);
+}
+
+#ifndef NO_MULTITHREADING
+TEST(scalar_multiplication, pippenger_non_power_of_two_threads)
+{
+    constexpr size_t num_points = 4096 + 1000;
+
+    fr* scalars = (fr*)aligned_alloc(32, sizeof(fr) * num_points);
+    g1::affine_element* points = scalar_multiplication::point_table_alloc<g1::affine_element>(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        scalars[i] = fr::random_element();
+        points[i] = g1::affine_element(g1::element::random_element());
+    }
+
+    g1::element expected;
+    expected.self_set_infinity();
+    for (size_t i = 0; i < num_points; ++i) {
+        expected += points[i] * scalars[i];
+    }
+    scalar_multiplication::generate_pippenger_point_table(points, points, num_points);
+
+    const int num_threads = omp_get_max_threads();
+    omp_set_num_threads(3);
+    g1::element result;
+    g1::element booth_result;
+    {
+        scalar_multiplication::pippenger_runtime_state state(num_points);
+        result = scalar_multiplication::pippenger_unsafe(scalars, points, num_points, state);
+        booth_result = scalar_multiplication::pippenger_unsafe(
+            scalars, points, num_points, state, scalar_multiplication::RecodingMode::BOOTH);
+    }
+    omp_set_num_threads(num_threads);
+
+    aligned_free(scalars);
+    aligned_free(points);
+
+    EXPECT_EQ(result.normalize() == expected.normalize(), true);
+    EXPECT_EQ(booth_result.normalize() == expected.normalize(), true);
+}
+#endif
+
 TEST(scalar_multiplication, pippenger_one)
 {
     size_t num_points = 1;
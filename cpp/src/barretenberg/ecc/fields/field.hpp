@@ -203,8 +203,23 @@ template <class Params> struct alignas(32) field {
     static constexpr uint256_t modulus_minus_two =
         uint256_t(Params::modulus_0 - 2ULL, Params::modulus_1, Params::modulus_2, Params::modulus_3);
     constexpr field invert() const noexcept;
+    /**
+     * @brief Replace every non-zero element of `coeffs` with its inverse, using Montgomery's trick. Zeroes are left
+     * unchanged.
+     *
+     * @details Large inputs are split into blocks of `BATCH_INVERT_BLOCK_SIZE` elements that are inverted
+     * independently, in parallel. Each block costs one extra inversion, and keeps its temporaries in cache.
+     */
     static void batch_invert(std::span<field> coeffs) noexcept;
     static void batch_invert(field* coeffs, const size_t n) noexcept;
+    static constexpr size_t BATCH_INVERT_BLOCK_SIZE = 1UL << 13;
+    /**
+     * @brief out[i] = a[i] * b[i]. `out` may alias `a` or `b`.
+     *
+     * @details On CPUs with AVX-512 IFMA, 8 products are computed at a time (see field_impl_ifma.hpp). Otherwise, or
+     * for moduli of 254 bits or more, this falls back to `operator*`.
+     */
+    static void mul_batch(std::span<const field> a, std::span<const field> b, std::span<field> out) noexcept;
     /**
      * @brief Compute square root of the field element.
      *
@@ -411,6 +426,8 @@ template <class Params> struct alignas(32) field {
     static constexpr uint256_t not_modulus = -modulus;
     static constexpr uint256_t twice_not_modulus = -twice_modulus;
 
+    static void batch_invert_block(std::span<field> coeffs) noexcept;
+
     struct wnaf_table {
         uint8_t windows[64];
 
@@ -556,5 +573,6 @@ template <typename B, typename Params> void write(B& buf, field<Params> const& v
 
 } // namespace barretenberg
 
+#include "./field_impl_ifma.hpp"
 #include "./field_impl.hpp"
 #include "field_impl_x64.hpp"
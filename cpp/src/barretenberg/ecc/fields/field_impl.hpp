@@ -2,6 +2,8 @@
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
+#include <algorithm>
+#include <array>
 #include <span>
 #include <type_traits>
 #include <vector>
@@ -373,33 +375,119 @@ template <class T> void field<T>::batch_invert(field* coeffs, const size_t n) no
 template <class T> void field<T>::batch_invert(std::span<field> coeffs) noexcept
 {
     const size_t n = coeffs.size();
+    const size_t num_blocks = (n + BATCH_INVERT_BLOCK_SIZE - 1) / BATCH_INVERT_BLOCK_SIZE;
+    if (num_blocks <= 1) {
+        batch_invert_block(coeffs);
+        return;
+    }
+#ifndef NO_MULTITHREADING
+#pragma omp parallel for
+#endif
+    for (size_t i = 0; i < num_blocks; ++i) {
+        const size_t start = i * BATCH_INVERT_BLOCK_SIZE;
+        batch_invert_block(coeffs.subspan(start, std::min(BATCH_INVERT_BLOCK_SIZE, n - start)));
+    }
+}
+
+template <class T> void field<T>::batch_invert_block(std::span<field> coeffs) noexcept
+{
+    // Montgomery's trick is a single chain of dependent multiplications. Running BATCH_INVERT_LANES independent chains
+    // over interleaved elements (element i belongs to chain i % BATCH_INVERT_LANES) lets every step be a `mul_batch`
+    // call. The chains are joined by a final batch inversion of their accumulators, so there is still one inversion.
+    constexpr size_t BATCH_INVERT_LANES = 8;
+    const size_t n = coeffs.size();
 
     std::vector<field> temporaries;
     std::vector<bool> skipped;
     temporaries.reserve(n);
     skipped.reserve(n);
 
-    field accumulator = one();
+    if (n < 2 * BATCH_INVERT_LANES) {
+        field accumulator = one();
+        for (size_t i = 0; i < n; ++i) {
+            temporaries.emplace_back(accumulator);
+            if (coeffs[i].is_zero()) {
+                skipped.emplace_back(true);
+            } else {
+                skipped.emplace_back(false);
+                accumulator *= coeffs[i];
+            }
+        }
+
+        accumulator = accumulator.invert();
+
+        field T0;
+        for (size_t i = n - 1; i < n; --i) {
+            if (!skipped[i]) {
+                T0 = accumulator * temporaries[i];
+                accumulator *= coeffs[i];
+                coeffs[i] = T0;
+            }
+        }
+        return;
+    }
+
+    // zeroes are replaced by one so that they pass through the chains unchanged, and restored at the end
     for (size_t i = 0; i < n; ++i) {
-        temporaries.emplace_back(accumulator);
-        if (coeffs[i].is_zero()) {
-            skipped.emplace_back(true);
-        } else {
-            skipped.emplace_back(false);
-            accumulator *= coeffs[i];
+        skipped.emplace_back(coeffs[i].is_zero());
+        if (skipped[i]) {
+            coeffs[i] = one();
         }
     }
+    temporaries.resize(n);
+
+    std::array<field, BATCH_INVERT_LANES> accumulators;
+    accumulators.fill(one());
+    for (size_t i = 0; i < n; i += BATCH_INVERT_LANES) {
+        const size_t num_lanes = std::min(BATCH_INVERT_LANES, n - i);
+        std::span<field> lanes{ &accumulators[0], num_lanes };
+        std::copy(lanes.begin(), lanes.end(), &temporaries[i]);
+        mul_batch(lanes, coeffs.subspan(i, num_lanes), lanes);
+    }
+
+    batch_invert_block(std::span{ accumulators });
+
+    // walk the chunks backwards, starting with the (possibly partial) last one
+    const size_t last_chunk = ((n - 1) / BATCH_INVERT_LANES) * BATCH_INVERT_LANES;
+    for (size_t i = last_chunk; i < n; i -= BATCH_INVERT_LANES) {
+        const size_t num_lanes = std::min(BATCH_INVERT_LANES, n - i);
+        std::span<field> lanes{ &accumulators[0], num_lanes };
+        std::span<field> chunk_temporaries{ &temporaries[i], num_lanes };
+        std::span<field> chunk = coeffs.subspan(i, num_lanes);
+        mul_batch(lanes, chunk_temporaries, chunk_temporaries);
+        mul_batch(lanes, chunk, lanes);
+        std::copy(chunk_temporaries.begin(), chunk_temporaries.end(), chunk.begin());
+    }
 
-    accumulator = accumulator.invert();
+    for (size_t i = 0; i < n; ++i) {
+        if (skipped[i]) {
+            coeffs[i] = zero();
+        }
+    }
+}
 
-    field T0;
-    for (size_t i = n - 1; i < n; --i) {
-        if (!skipped[i]) {
-            T0 = accumulator * temporaries[i];
-            accumulator *= coeffs[i];
-            coeffs[i] = T0;
+template <class T>
+void field<T>::mul_batch(std::span<const field> a, std::span<const field> b, std::span<field> out) noexcept
+{
+    ASSERT(a.size() == out.size() && b.size() == out.size());
+    const size_t n = out.size();
+    size_t i = 0;
+#if (BBERG_NO_ASM == 0)
+    // < 254-bits and > 64-bits
+    if constexpr ((T::modulus_3 < 0x4000000000000000ULL) &&
+                  (T::modulus_1 != 0 || T::modulus_2 != 0 || T::modulus_3 != 0)) {
+        if (ifma::is_supported()) {
+            static constexpr std::array<uint64_t, ifma::NUM_LIMBS> modulus_limbs =
+                ifma::to_limbs(T::modulus_0, T::modulus_1, T::modulus_2, T::modulus_3);
+            for (; i + ifma::BATCH_SIZE <= n; i += ifma::BATCH_SIZE) {
+                ifma::montgomery_mul(&a[i].data[0], &b[i].data[0], &out[i].data[0], modulus_limbs, T::r_inv);
+            }
         }
     }
+#endif
+    for (; i < n; ++i) {
+        out[i] = a[i] * b[i];
+    }
 }
 
 template <class T> constexpr field<T> field<T>::tonelli_shanks_sqrt() const noexcept
@@ -0,0 +1,161 @@
+#pragma once
+
+#if (BBERG_NO_ASM == 0)
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <immintrin.h>
+
+/**
+ * AVX-512 IFMA Montgomery multiplication, 8 field elements at a time.
+ *
+ * The IFMA instructions (vpmadd52luq / vpmadd52huq) multiply the low 52 bits of each 64-bit lane and accumulate the
+ * low or high 52 bits of the 104-bit product. Field elements are therefore split into 5 limbs of 52 bits, one element
+ * per lane, and reduced with word-by-word Montgomery reduction in radix 2^52, i.e. by R' = 2^260.
+ *
+ * Our elements are in Montgomery form with R = 2^256. To keep that form, the second operand is shifted left by 4 bits
+ * on load: (aR).(16.bR).2^{-260} = abR. This needs 16.b to fit in 5 limbs. For a modulus p < 2^254 and inputs in the
+ * coarse form [0, 2p), 16.b < 32p < 2^259, and the Montgomery output is bounded by
+ *
+ *     (a.16b + (2^260 - 1).p) / 2^260 < (64p^2 + 2^260.p) / 2^260 < 2p
+ *
+ * so outputs are in the same coarse form as `field::operator*`.
+ *
+ * The kernels are compiled for AVX-512 regardless of the target architecture, and `field::mul_batch` only calls them
+ * if `is_supported()` reports that the CPU has IFMA.
+ **/
+#define BBERG_IFMA_TARGET __attribute__((target("avx512f,avx512ifma")))
+
+namespace barretenberg::ifma {
+
+constexpr size_t LIMB_BITS = 52;
+constexpr uint64_t LIMB_MASK = (1ULL << LIMB_BITS) - 1;
+constexpr size_t NUM_LIMBS = 5;
+constexpr size_t BATCH_SIZE = 8;
+
+constexpr std::array<uint64_t, NUM_LIMBS> to_limbs(const uint64_t w0,
+                                                   const uint64_t w1,
+                                                   const uint64_t w2,
+                                                   const uint64_t w3) noexcept
+{
+    return { w0 & LIMB_MASK,
+             ((w0 >> 52) | (w1 << 12)) & LIMB_MASK,
+             ((w1 >> 40) | (w2 << 24)) & LIMB_MASK,
+             ((w2 >> 28) | (w3 << 36)) & LIMB_MASK,
+             w3 >> 16 };
+}
+
+inline bool is_supported() noexcept
+{
+    static const bool supported = []() {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx512ifma") != 0;
+    }();
+    return supported;
+}
+
+// The unmasked gathers and shifts pass `_mm512_undefined_epi32()` as the source of their (unused) masked-off lanes,
+// which GCC 12 flags as uninitialised once they are inlined (GCC bug 105593). We use the masked forms with a full
+// mask and a zeroed source instead; they compile to the same instructions.
+BBERG_IFMA_TARGET inline __m512i shift_left(const __m512i x, const unsigned int bits) noexcept
+{
+    return _mm512_maskz_slli_epi64(0xFF, x, bits);
+}
+
+BBERG_IFMA_TARGET inline __m512i shift_right(const __m512i x, const unsigned int bits) noexcept
+{
+    return _mm512_maskz_srli_epi64(0xFF, x, bits);
+}
+
+// Load word `i` of 8 consecutive field elements into the lanes of words[i]
+BBERG_IFMA_TARGET inline void gather_words(const uint64_t* src, __m512i* words) noexcept
+{
+    const __m512i index = _mm512_set_epi64(28, 24, 20, 16, 12, 8, 4, 0);
+    const __m512i zero = _mm512_setzero_si512();
+    for (size_t i = 0; i < 4; ++i) {
+        words[i] = _mm512_mask_i64gather_epi64(zero, 0xFF, index, static_cast<const void*>(src + i), 8);
+    }
+}
+
+BBERG_IFMA_TARGET inline void scatter_words(uint64_t* dest, const __m512i* words) noexcept
+{
+    const __m512i index = _mm512_set_epi64(28, 24, 20, 16, 12, 8, 4, 0);
+    for (size_t i = 0; i < 4; ++i) {
+        _mm512_i64scatter_epi64(static_cast<void*>(dest + i), index, words[i], 8);
+    }
+}
+
+/**
+ * r[i] = a[i] * b[i] for 8 consecutive field elements, where `a`, `b` and `r` point to the limbs of the first element.
+ * `r` may alias `a` or `b`.
+ **/
+BBERG_IFMA_TARGET inline void montgomery_mul(const uint64_t* a,
+                                             const uint64_t* b,
+                                             uint64_t* r,
+                                             const std::array<uint64_t, NUM_LIMBS>& modulus,
+                                             const uint64_t r_inv) noexcept
+{
+    const __m512i mask = _mm512_set1_epi64(static_cast<int64_t>(LIMB_MASK));
+    const __m512i zero = _mm512_setzero_si512();
+    __m512i words[4];
+
+    __m512i x[NUM_LIMBS];
+    gather_words(a, words);
+    x[0] = _mm512_and_si512(words[0], mask);
+    x[1] = _mm512_and_si512(_mm512_or_si512(shift_right(words[0], 52), shift_left(words[1], 12)), mask);
+    x[2] = _mm512_and_si512(_mm512_or_si512(shift_right(words[1], 40), shift_left(words[2], 24)), mask);
+    x[3] = _mm512_and_si512(_mm512_or_si512(shift_right(words[2], 28), shift_left(words[3], 36)), mask);
+    x[4] = shift_right(words[3], 16);
+
+    // 16.b
+    __m512i y[NUM_LIMBS];
+    gather_words(b, words);
+    y[0] = _mm512_and_si512(shift_left(words[0], 4), mask);
+    y[1] = _mm512_and_si512(_mm512_or_si512(shift_right(words[0], 48), shift_left(words[1], 16)), mask);
+    y[2] = _mm512_and_si512(_mm512_or_si512(shift_right(words[1], 36), shift_left(words[2], 28)), mask);
+    y[3] = _mm512_and_si512(_mm512_or_si512(shift_right(words[2], 24), shift_left(words[3], 40)), mask);
+    y[4] = shift_right(words[3], 12);
+
+    __m512i p[NUM_LIMBS];
+    for (size_t j = 0; j < NUM_LIMBS; ++j) {
+        p[j] = _mm512_set1_epi64(static_cast<int64_t>(modulus[j]));
+    }
+    const __m512i k = _mm512_set1_epi64(static_cast<int64_t>(r_inv & LIMB_MASK));
+
+    // The limbs of t are not normalised inside the loop. Each round adds at most 4 52-bit values to a limb, so after
+    // 5 rounds every limb is below 2^57.
+    __m512i t[NUM_LIMBS + 1];
+    for (size_t j = 0; j <= NUM_LIMBS; ++j) {
+        t[j] = zero;
+    }
+    for (size_t i = 0; i < NUM_LIMBS; ++i) {
+        for (size_t j = 0; j < NUM_LIMBS; ++j) {
+            t[j] = _mm512_madd52lo_epu64(t[j], x[j], y[i]);
+            t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], x[j], y[i]);
+        }
+        const __m512i m = _mm512_madd52lo_epu64(zero, t[0], k);
+        for (size_t j = 0; j < NUM_LIMBS; ++j) {
+            t[j] = _mm512_madd52lo_epu64(t[j], m, p[j]);
+            t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], m, p[j]);
+        }
+        // the low 52 bits of t[0] are now zero
+        t[1] = _mm512_add_epi64(t[1], shift_right(t[0], 52));
+        for (size_t j = 0; j < NUM_LIMBS; ++j) {
+            t[j] = t[j + 1];
+        }
+        t[NUM_LIMBS] = zero;
+    }
+    for (size_t j = 0; j < NUM_LIMBS - 1; ++j) {
+        t[j + 1] = _mm512_add_epi64(t[j + 1], shift_right(t[j], 52));
+        t[j] = _mm512_and_si512(t[j], mask);
+    }
+
+    words[0] = _mm512_or_si512(t[0], shift_left(t[1], 52));
+    words[1] = _mm512_or_si512(shift_right(t[1], 12), shift_left(t[2], 40));
+    words[2] = _mm512_or_si512(shift_right(t[2], 24), shift_left(t[3], 28));
+    words[3] = _mm512_or_si512(shift_right(t[3], 36), shift_left(t[4], 16));
+    scatter_words(r, words);
+}
+
+} // namespace barretenberg::ifma
+#endif
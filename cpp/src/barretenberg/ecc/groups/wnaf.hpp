@@ -325,6 +325,71 @@ inline void fixed_wnaf_with_counts(const uint64_t* scalar,
     }
 }
 
+/**
+ * Signed-digit (Booth) recoding of a 128-bit scalar into x-bit windows.
+ *
+ * Each window w_i is read together with the carry from the window below it. If w_i + carry > 2^{x-1}, we subtract
+ * 2^x from the digit and carry 1 into the next window. Digits therefore lie in [-2^{x-1}, 2^{x-1}], so an x-bit window
+ * only needs 2^{x-1} buckets (magnitude d lives in bucket d - 1), the same as our odd-digit wnaf.
+ *
+ * Unlike `fixed_wnaf_with_counts`, digits can be zero. Zero digits are written as 0xffffffffffffffff and are not
+ * counted in `round_counts`, so the point is skipped for that round. There is no skew to correct for at the end of the
+ * scalar multiplication.
+ *
+ * The top window holds SCALAR_BITS - (num_entries - 1) * x bits. As SCALAR_BITS is prime, this is always strictly less
+ * than x, so the top digit never produces a carry and we need no extra round.
+ *
+ * In *booth we store the following (the same layout as `fixed_wnaf_with_counts`):
+ *  1. bits 0-30: bucket index (|digit| - 1)
+ *  2. bit 31: 'predicate' bool (i.e. does the point need to be negated?)
+ *  3. bits 32-63: position in a point array that describes the elliptic curve point this digit is referencing
+ *
+ * @param scalar Pointer to the 128-bit non-montgomery scalar that is supposed to be recoded
+ * @param booth Pointer to output array that needs to accomodate enough 64-bit entries
+ * @param round_counts Pointer to output array specifying the number of points participating in each round
+ * @param point_index The index of the point that should be multiplied by this scalar, shifted into the high 32 bits
+ * @param num_points Total points in the MSM (2*num_initial_points)
+ * @param booth_bits Window size x
+ * @param window_point_offset Added to `point_index` once per window (pre-shifted into the high 32 bits). Used by
+ * fixed-base pippenger, where window i reads its point from the i-th shifted copy of the point table
+ */
+inline void fixed_booth_with_counts(const uint64_t* scalar,
+                                    uint64_t* booth,
+                                    uint64_t* round_counts,
+                                    const uint64_t point_index,
+                                    const uint64_t num_points,
+                                    const size_t booth_bits,
+                                    const uint64_t window_point_offset = 0) noexcept
+{
+    const size_t num_entries = (SCALAR_BITS + booth_bits - 1) / booth_bits;
+    const uint64_t half_window = 1ULL << (booth_bits - 1);
+    const uint64_t full_window = 1ULL << booth_bits;
+
+    uint64_t carry = 0;
+    for (size_t i = 0; i < num_entries; ++i) {
+        const size_t bit_position = i * booth_bits;
+        const size_t slice_bits = (i == num_entries - 1) ? SCALAR_BITS - bit_position : booth_bits;
+        const uint64_t slice = get_wnaf_bits(scalar, slice_bits, bit_position) + carry;
+
+        // most significant window is processed in round 0
+        uint64_t& entry = booth[(num_entries - 1 - i) * num_points];
+        if (slice == 0 || slice == full_window) {
+            entry = 0xffffffffffffffffULL;
+            carry = slice >> booth_bits;
+            continue;
+        }
+        ++round_counts[num_entries - 1 - i];
+        const uint64_t window_point_index = point_index + i * window_point_offset;
+        if (slice > half_window) {
+            entry = (full_window - slice - 1) | (1ULL << 31ULL) | window_point_index;
+            carry = 1;
+        } else {
+            entry = (slice - 1) | window_point_index;
+            carry = 0;
+        }
+    }
+}
+
 template <size_t num_points, size_t wnaf_bits, size_t round_i>
 inline void wnaf_round(uint64_t* scalar, uint64_t* wnaf, const uint64_t point_index, const uint64_t previous) noexcept
 {
@@ -169,3 +169,36 @@ TEST(wnaf, wnaf_fixed_with_endo_split)
 
     EXPECT_EQ(result, k);
 }
+
+TEST(wnaf, booth_fixed_with_counts)
+{
+    constexpr size_t booth_bits = 5;
+    constexpr size_t num_entries = WNAF_SIZE(booth_bits);
+    for (size_t trial = 0; trial < 3; ++trial) {
+        uint256_t buffer = engine.get_random_uint256();
+        buffer.data[1] &= 0x7fffffffffffffffUL;
+        if (trial == 1) {
+            // every window saturated, which exercises the carry chain
+            buffer.data[0] = 0xffffffffffffffffUL;
+            buffer.data[1] = 0x7fffffffffffffffUL;
+        }
+        uint64_t booth[num_entries] = { 0 };
+        uint64_t round_counts[num_entries] = { 0 };
+        wnaf::fixed_booth_with_counts(&buffer.data[0], booth, round_counts, 0, 1, booth_bits);
+
+        uint128_t recovered = 0;
+        for (size_t i = 0; i < num_entries; ++i) {
+            if (booth[i] == 0xffffffffffffffffULL) {
+                EXPECT_EQ(round_counts[i], 0UL);
+                continue;
+            }
+            EXPECT_EQ(round_counts[i], 1UL);
+            const uint64_t magnitude = (booth[i] & 0x7fffffffU) + 1;
+            EXPECT_LE(magnitude, 1UL << (booth_bits - 1));
+            const uint128_t term = (uint128_t)magnitude << (uint128_t)(booth_bits * (num_entries - 1 - i));
+            recovered = ((booth[i] >> 31) & 1) ? recovered - term : recovered + term;
+        }
+        EXPECT_EQ((uint64_t)recovered, buffer.data[0]);
+        EXPECT_EQ((uint64_t)(recovered >> 64), buffer.data[1]);
+    }
+}
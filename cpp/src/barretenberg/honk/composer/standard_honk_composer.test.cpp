@@ -11,6 +11,12 @@
 
 #include <gtest/gtest.h>
 
+#ifndef __wasm__
+#include "barretenberg/plonk/proof_system/proving_key/proving_key_file.hpp"
+#include <filesystem>
+#include <unistd.h>
+#endif
+
 using namespace proof_system::honk;
 
 namespace test_standard_honk_composer {
@@ -350,4 +356,36 @@ TEST(StandardHonkComposer, TwoGates)
     run_test(/* expect_verified=*/true);
     run_test(/* expect_verified=*/false);
 }
+
+#ifndef __wasm__
+TEST(StandardHonkComposer, ProvingKeyFile)
+{
+    const std::string path =
+        (std::filesystem::temp_directory_path() / ("honk_proving_key_" + std::to_string(getpid()))).string();
+    auto add_gates = [](StandardHonkComposer& composer) {
+        uint32_t a_idx = composer.circuit_constructor.add_variable(2);
+        uint32_t b_idx = composer.circuit_constructor.add_variable(2);
+        uint32_t c_idx = composer.circuit_constructor.add_variable(4);
+        composer.create_mul_gate({ a_idx, b_idx, c_idx, 1, -1, 0 });
+    };
+
+    auto composer = StandardHonkComposer();
+    add_gates(composer);
+    auto verification_key = composer.compute_verification_key();
+    plonk::write_proving_key_file(path, *composer.compute_proving_key());
+
+    auto pk_data = plonk::read_proving_key_file(path);
+    std::filesystem::remove(path);
+    auto crs = std::make_unique<proof_system::FileReferenceStringFactory>("../srs_db/ignition");
+    const size_t circuit_size = pk_data.circuit_size;
+    auto proving_key = std::make_shared<plonk::proving_key>(std::move(pk_data), crs->get_prover_crs(circuit_size + 1));
+
+    auto composer2 = StandardHonkComposer(proving_key, verification_key);
+    add_gates(composer2);
+    auto prover = composer2.create_prover();
+    plonk::proof proof = prover.construct_proof();
+    auto verifier = composer2.create_verifier();
+    EXPECT_TRUE(verifier.verify_proof(proof));
+}
+#endif
 } // namespace test_standard_honk_composer
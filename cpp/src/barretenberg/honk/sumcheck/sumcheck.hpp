@@ -61,6 +61,9 @@ template <typename FF, class Transcript, template <class> class... Relations> cl
     * TODO(#224)(Cody): might want to just do C-style multidimensional array? for guaranteed adjacency?
     */
     std::array<std::vector<FF>, NUM_POLYNOMIALS> folded_polynomials;
+    // From the second round on, `fold` reads `folded_polynomials`, so the folded values are written here and the two
+    // are then swapped.
+    std::array<std::vector<FF>, NUM_POLYNOMIALS> fold_scratch_space;
 
     // prover instantiates sumcheck with circuit size and a prover transcript
     Sumcheck(size_t multivariate_n, ProverTranscript<FF>& transcript)
@@ -72,6 +75,9 @@ template <typename FF, class Transcript, template <class> class... Relations> cl
         for (auto& polynomial : folded_polynomials) {
             polynomial.resize(multivariate_n >> 1);
         }
+        for (auto& polynomial : fold_scratch_space) {
+            polynomial.resize(multivariate_n >> 2);
+        }
     };
 
     // verifier instantiates sumcheck with circuit size and a verifier transcript
@@ -204,17 +210,34 @@ template <typename FF, class Transcript, template <class> class... Relations> cl
      *     g3 -- v6 (1-X0)  X1    X2   --- (v6(1-X0) + v7 X0)   X1    X2  -/
      *        \- v7   X0    X1    X2   --/
      *
+     * The edges are split into contiguous ranges that are folded in parallel. A thread's outputs can overlap another
+     * thread's inputs when folding `folded_polynomials` into itself, so after the first round the results go to
+     * `fold_scratch_space`, which is then swapped with `folded_polynomials`.
+     *
      * @param challenge
      */
     void fold(auto& polynomials, size_t round_size, FF round_challenge)
     {
-        // after the first round, operate in place on folded_polynomials
-        for (size_t j = 0; j < polynomials.size(); ++j) {
-            for (size_t i = 0; i < round_size; i += 2) {
-                folded_polynomials[j][i >> 1] =
-                    polynomials[j][i] + round_challenge * (polynomials[j][i + 1] - polynomials[j][i]);
+        const size_t num_edges = (round_size + 1) >> 1;
+        const bool in_place = (&polynomials[0][0] == folded_polynomials[0].data());
+        auto& targets = in_place ? fold_scratch_space : folded_polynomials;
+        const size_t num_threads = decltype(round)::compute_num_threads(num_edges);
+#ifndef NO_MULTITHREADING
+#pragma omp parallel for
+#endif
+        for (size_t k = 0; k < num_threads; ++k) {
+            const auto [start, end] = max_threads::get_thread_range(num_edges, num_threads, k);
+            for (size_t j = 0; j < polynomials.size(); ++j) {
+                for (size_t i = start; i < end; ++i) {
+                    const FF& left = polynomials[j][i << 1];
+                    const FF& right = polynomials[j][(i << 1) + 1];
+                    targets[j][i] = left + round_challenge * (right - left);
+                }
             }
         }
+        if (in_place) {
+            std::swap(folded_polynomials, fold_scratch_space);
+        }
     };
 };
 } // namespace proof_system::honk::sumcheck
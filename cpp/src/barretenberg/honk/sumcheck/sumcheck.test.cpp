@@ -19,6 +19,9 @@
 #include <string>
 #include <sys/types.h>
 #include <vector>
+#ifndef NO_MULTITHREADING
+#include <omp.h>
+#endif
 
 using namespace proof_system::honk;
 using namespace proof_system::honk::sumcheck;
@@ -430,4 +433,72 @@ TEST(Sumcheck, ProverAndVerifierLonger)
     run_test(/* expect_verified=*/false);
 }
 
+/**
+ * @brief Run a larger satisfied instance with several threads, and check that the prover output does not depend on how
+ * the edges are split between threads.
+ */
+TEST(Sumcheck, ProverAndVerifierMultithreaded)
+{
+    const size_t multivariate_n(1 << 10);
+
+    // Every row is an addition gate w_l + w_r - w_o = 0. Setting the permutation polynomials to 0 ensures the
+    // GrandProductRelation is satisfied.
+    std::array<std::vector<FF>, NUM_POLYNOMIALS> polynomials;
+    for (auto& polynomial : polynomials) {
+        polynomial.resize(multivariate_n, FF(0));
+    }
+    for (size_t i = 0; i < multivariate_n; ++i) {
+        polynomials[POLYNOMIAL::W_L][i] = FF::random_element();
+        polynomials[POLYNOMIAL::W_R][i] = FF::random_element();
+        polynomials[POLYNOMIAL::W_O][i] = polynomials[POLYNOMIAL::W_L][i] + polynomials[POLYNOMIAL::W_R][i];
+        polynomials[POLYNOMIAL::Q_L][i] = 1;
+        polynomials[POLYNOMIAL::Q_R][i] = 1;
+        polynomials[POLYNOMIAL::Q_O][i] = -1;
+    }
+    std::array<std::span<FF>, NUM_POLYNOMIALS> full_polynomials;
+    for (size_t i = 0; i < NUM_POLYNOMIALS; ++i) {
+        full_polynomials[i] = polynomials[i];
+    }
+
+    sumcheck::RelationParameters<FF> relation_parameters{
+        .beta = FF::random_element(),
+        .gamma = FF::random_element(),
+        .public_input_delta = FF::one(),
+    };
+
+    auto run_prover = [&](const size_t num_threads) {
+#ifndef NO_MULTITHREADING
+        const int max_threads = omp_get_max_threads();
+        omp_set_num_threads(static_cast<int>(num_threads));
+#else
+        static_cast<void>(num_threads);
+#endif
+        auto prover_transcript = ProverTranscript<FF>::init_empty();
+        auto sumcheck_prover = Sumcheck<FF,
+                                        ProverTranscript<FF>,
+                                        ArithmeticRelation,
+                                        GrandProductComputationRelation,
+                                        GrandProductInitializationRelation>(multivariate_n, prover_transcript);
+        auto prover_output = sumcheck_prover.execute_prover(full_polynomials, relation_parameters);
+#ifndef NO_MULTITHREADING
+        omp_set_num_threads(max_threads);
+#endif
+        return std::make_pair(prover_output, prover_transcript);
+    };
+
+    auto [serial_output, serial_transcript] = run_prover(1);
+    auto [parallel_output, parallel_transcript] = run_prover(5);
+    EXPECT_EQ(serial_output.evaluations, parallel_output.evaluations);
+    EXPECT_EQ(serial_output.challenge_point, parallel_output.challenge_point);
+
+    auto verifier_transcript = VerifierTranscript<FF>::init_empty(parallel_transcript);
+    auto sumcheck_verifier = Sumcheck<FF,
+                                      VerifierTranscript<FF>,
+                                      ArithmeticRelation,
+                                      GrandProductComputationRelation,
+                                      GrandProductInitializationRelation>(multivariate_n, verifier_transcript);
+    std::optional verifier_output = sumcheck_verifier.execute_verifier(relation_parameters);
+    EXPECT_TRUE(verifier_output.has_value());
+}
+
 } // namespace test_sumcheck_round
@@ -1,8 +1,10 @@
 #pragma once
 #include "barretenberg/common/log.hpp"
+#include "barretenberg/common/max_threads.hpp"
 #include <array>
 #include <algorithm>
 #include <tuple>
+#include <vector>
 #include "polynomials/barycentric_data.hpp"
 #include "polynomials/univariate.hpp"
 #include "polynomials/pow.hpp"
@@ -60,13 +62,18 @@ template <class FF, size_t num_multivariates, template <class> class... Relation
     static constexpr size_t NUM_RELATIONS = sizeof...(Relations);
     static constexpr size_t MAX_RELATION_LENGTH = std::max({ Relations<FF>::RELATION_LENGTH... });
 
+    // Rounds with fewer edges per thread than this are computed by fewer threads
+    static constexpr size_t MIN_EDGES_PER_THREAD = 32;
+
+    using RelationUnivariates = std::tuple<Univariate<FF, Relations<FF>::RELATION_LENGTH>...>;
+    using ExtendedEdges = std::array<Univariate<FF, MAX_RELATION_LENGTH>, num_multivariates>;
+
     FF target_total_sum = 0;
 
     // TODO(#224)(Cody): this barycentric stuff should be more built-in?
     std::tuple<BarycentricData<FF, Relations<FF>::RELATION_LENGTH, MAX_RELATION_LENGTH>...> barycentric_utils;
-    std::tuple<Univariate<FF, Relations<FF>::RELATION_LENGTH>...> univariate_accumulators;
+    RelationUnivariates univariate_accumulators;
     std::array<FF, NUM_RELATIONS> evaluations;
-    std::array<Univariate<FF, MAX_RELATION_LENGTH>, num_multivariates> extended_edges;
     std::array<Univariate<FF, MAX_RELATION_LENGTH>, NUM_RELATIONS> extended_univariates;
 
     // TODO(#224)(Cody): this should go away and we should use constexpr method to extend
@@ -89,16 +96,39 @@ template <class FF, size_t num_multivariates, template <class> class... Relation
         std::fill(evaluations.begin(), evaluations.end(), FF(0));
     };
 
+    /**
+     * @brief Number of threads used to process `num_edges` edges, so that each thread gets at least
+     * MIN_EDGES_PER_THREAD of them.
+     */
+    static size_t compute_num_threads(const size_t num_edges)
+    {
+        const size_t num_threads = max_threads::compute_num_threads_unrounded();
+        return std::max(size_t(1), std::min(num_threads, num_edges / MIN_EDGES_PER_THREAD));
+    }
+
     /**
      * @brief After computing the round univariate, it is necessary to zero-out the accumulators used to compute it.
      */
-    template <size_t idx = 0> void reset_accumulators()
+    template <size_t idx = 0> static void reset_accumulators(RelationUnivariates& accumulators)
     {
-        auto& univariate = std::get<idx>(univariate_accumulators);
+        auto& univariate = std::get<idx>(accumulators);
         std::fill(univariate.evaluations.begin(), univariate.evaluations.end(), FF(0));
 
         if constexpr (idx + 1 < NUM_RELATIONS) {
-            reset_accumulators<idx + 1>();
+            reset_accumulators<idx + 1>(accumulators);
+        }
+    };
+
+    /**
+     * @brief Add each univariate of `other` to the corresponding univariate of `accumulators`.
+     */
+    template <size_t idx = 0>
+    static void add_accumulators(RelationUnivariates& accumulators, const RelationUnivariates& other)
+    {
+        std::get<idx>(accumulators) += std::get<idx>(other);
+
+        if constexpr (idx + 1 < NUM_RELATIONS) {
+            add_accumulators<idx + 1>(accumulators, other);
         }
     };
     // IMPROVEMENT(Cody): This is kind of ugly. There should be a one-liner with folding
@@ -143,7 +173,7 @@ template <class FF, size_t num_multivariates, template <class> class... Relation
      * @details Should only be called externally with relation_idx equal to 0.
      *
      */
-    void extend_edges(auto& multivariates, size_t edge_idx)
+    void extend_edges(ExtendedEdges& extended_edges, auto& multivariates, size_t edge_idx)
     {
         for (size_t idx = 0; idx < num_multivariates; idx++) {
             auto edge = Univariate<FF, 2>({ multivariates[idx][edge_idx], multivariates[idx][edge_idx + 1] });
@@ -172,29 +202,54 @@ template <class FF, size_t num_multivariates, template <class> class... Relation
      * @brief Return the evaluations of the univariate restriction (S_l(X_l) in the thesis) at num_multivariates-many
      * values. Most likely this will end up being S_l(0), ... , S_l(t-1) where t is around 12. At the end, reset all
      * univariate accumulators to be zero.
+     *
+     * @details The edges are split into contiguous ranges, one per thread. Each thread accumulates the contributions
+     * of its range into its own accumulators, starting from the pow polynomial's contribution at its first edge. The
+     * thread accumulators are then summed in thread order.
      */
     Univariate<FF, MAX_RELATION_LENGTH> compute_univariate(auto& polynomials,
                                                            const RelationParameters<FF>& relation_parameters,
                                                            const PowUnivariate<FF>& pow_univariate,
                                                            const FF alpha)
     {
-        // For each edge_idx = 2i, we need to multiply the whole contribution by zeta^{2^{2i}}
-        // This means that each univariate for each relation needs an extra multiplication.
-        FF pow_challenge = pow_univariate.partial_evaluation_constant;
-        for (size_t edge_idx = 0; edge_idx < round_size; edge_idx += 2) {
-            extend_edges(polynomials, edge_idx);
-
-            // Compute the i-th edge's univariate contribution,
-            // scale it by the pow polynomial's constant and zeta power "c_l ⋅ ζ_{l+1}ⁱ"
-            // and add it to the accumulators for Sˡ(Xₗ)
-            accumulate_relation_univariates<>(relation_parameters, pow_challenge);
-            // Update the pow polynomial's contribution c_l ⋅ ζ_{l+1}ⁱ for the next edge.
-            pow_challenge *= pow_univariate.zeta_pow_sqr;
+        // the edges start at every even index below round_size
+        const size_t num_edges = (round_size + 1) >> 1;
+        const size_t num_threads = compute_num_threads(num_edges);
+        std::vector<RelationUnivariates> thread_accumulators(num_threads);
+        std::vector<ExtendedEdges> thread_extended_edges(num_threads);
+
+#ifndef NO_MULTITHREADING
+#pragma omp parallel for
+#endif
+        for (size_t j = 0; j < num_threads; ++j) {
+            auto& accumulators = thread_accumulators[j];
+            auto& extended_edges = thread_extended_edges[j];
+            reset_accumulators<>(accumulators);
+            const auto [start, end] = max_threads::get_thread_range(num_edges, num_threads, j);
+
+            // For each edge_idx = 2i, we need to multiply the whole contribution by zeta^{2^{2i}}
+            // This means that each univariate for each relation needs an extra multiplication.
+            FF pow_challenge = pow_univariate.partial_evaluation_constant *
+                               pow_univariate.zeta_pow_sqr.pow(static_cast<uint64_t>(start));
+            for (size_t i = start; i < end; ++i) {
+                extend_edges(extended_edges, polynomials, i << 1);
+
+                // Compute the i-th edge's univariate contribution,
+                // scale it by the pow polynomial's constant and zeta power "c_l ⋅ ζ_{l+1}ⁱ"
+                // and add it to the accumulators for Sˡ(Xₗ)
+                accumulate_relation_univariates<>(accumulators, extended_edges, relation_parameters, pow_challenge);
+                // Update the pow polynomial's contribution c_l ⋅ ζ_{l+1}ⁱ for the next edge.
+                pow_challenge *= pow_univariate.zeta_pow_sqr;
+            }
+        }
+
+        for (const auto& accumulators : thread_accumulators) {
+            add_accumulators<>(univariate_accumulators, accumulators);
         }
 
         auto result = batch_over_relations<Univariate<FF, MAX_RELATION_LENGTH>>(alpha);
 
-        reset_accumulators<>();
+        reset_accumulators<>(univariate_accumulators);
 
         return result;
     }
@@ -280,18 +335,22 @@ template <class FF, size_t num_multivariates, template <class> class... Relation
      *                 relation adds a contribution
      *
      * Result: for each relation, a univariate of some degree is computed by accumulating the contributions of each
-     * group of edges. These are stored in `univariate_accumulators`. Adding these univariates together, with
+     * group of edges. These are stored in `accumulators`. Adding these univariates together, with
      * appropriate scaling factors, produces S_l.
      */
     template <size_t relation_idx = 0>
-    void accumulate_relation_univariates(const RelationParameters<FF>& relation_parameters, const FF& scaling_factor)
+    void accumulate_relation_univariates(RelationUnivariates& accumulators,
+                                         const ExtendedEdges& extended_edges,
+                                         const RelationParameters<FF>& relation_parameters,
+                                         const FF& scaling_factor)
     {
         std::get<relation_idx>(relations).add_edge_contribution(
-            std::get<relation_idx>(univariate_accumulators), extended_edges, relation_parameters, scaling_factor);
+            std::get<relation_idx>(accumulators), extended_edges, relation_parameters, scaling_factor);
 
         // Repeat for the next relation.
         if constexpr (relation_idx + 1 < NUM_RELATIONS) {
-            accumulate_relation_univariates<relation_idx + 1>(relation_parameters, scaling_factor);
+            accumulate_relation_univariates<relation_idx + 1>(
+                accumulators, extended_edges, relation_parameters, scaling_factor);
         }
     }
 
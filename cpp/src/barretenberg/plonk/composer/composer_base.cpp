@@ -5,7 +5,14 @@
 namespace proof_system::plonk {
 
 /**
- * Join variable class b to variable class a.
+ * Join the equivalence classes of a and b.
+ *
+ * @details The smaller class is spliced into the larger one, just ahead of the larger class's real variable, and only
+ * its members have their real variable index rewritten. A variable is only relabelled when its class at least doubles,
+ * so building classes of total size n by repeated calls costs O(n log n) rather than O(n^2). `real_variable_index`
+ * stays exact after every call, so it can be read directly when the copy cycles are computed.
+ *
+ * Whichever variable ends up real, the merged class keeps the value of a and, if a has one, the tag of a.
  *
  * @param a_variable_idx Index of a variable in class a.
  * @param b_variable_idx Index of a variable in class b.
@@ -23,20 +30,44 @@ void ComposerBase::assert_equal(const uint32_t a_variable_idx, const uint32_t b_
     // If a==b is already enforced, exit method
     if (a_real_idx == b_real_idx)
         return;
-    // Otherwise update the real_idx of b-chain members to that of a
-    auto b_start_idx = get_first_variable_in_class(b_variable_idx);
-    update_real_variable_indices(b_start_idx, a_real_idx);
-    // Now merge equivalence classes of a and b by tying last (= real) element of b-chain to first element of a-chain
-    auto a_start_idx = get_first_variable_in_class(a_variable_idx);
-    next_var_index[b_real_idx] = a_start_idx;
-    prev_var_index[a_start_idx] = b_real_idx;
+
+    // Walk both chains back from their real variables in step, until one of them runs out. This finds the smaller
+    // class, and its first variable, in time proportional to its size. On a tie, b is relabelled.
+    uint32_t a_cur_idx = a_real_idx;
+    uint32_t b_cur_idx = b_real_idx;
+    while (prev_var_index[a_cur_idx] != FIRST_VARIABLE_IN_CLASS &&
+           prev_var_index[b_cur_idx] != FIRST_VARIABLE_IN_CLASS) {
+        a_cur_idx = prev_var_index[a_cur_idx];
+        b_cur_idx = prev_var_index[b_cur_idx];
+    }
+    const bool relabel_b = prev_var_index[b_cur_idx] == FIRST_VARIABLE_IN_CLASS;
+    const uint32_t small_start_idx = relabel_b ? b_cur_idx : a_cur_idx;
+    const uint32_t small_real_idx = relabel_b ? b_real_idx : a_real_idx;
+    const uint32_t large_real_idx = relabel_b ? a_real_idx : b_real_idx;
+
+    update_real_variable_indices(small_start_idx, large_real_idx);
+    // Insert the smaller chain between the last two elements of the larger chain, so the real variable stays last.
+    const uint32_t large_prev_idx = prev_var_index[large_real_idx];
+    if (large_prev_idx != FIRST_VARIABLE_IN_CLASS) {
+        next_var_index[large_prev_idx] = small_start_idx;
+        prev_var_index[small_start_idx] = large_prev_idx;
+    }
+    next_var_index[small_real_idx] = large_real_idx;
+    prev_var_index[large_real_idx] = small_real_idx;
+
     bool no_tag_clash = (real_variable_tags[a_real_idx] == DUMMY_TAG || real_variable_tags[b_real_idx] == DUMMY_TAG ||
                          real_variable_tags[a_real_idx] == real_variable_tags[b_real_idx]);
     if (!no_tag_clash && !failed()) {
         failure(msg);
     }
-    if (real_variable_tags[a_real_idx] == DUMMY_TAG)
-        real_variable_tags[a_real_idx] = real_variable_tags[b_real_idx];
+    if (real_variable_tags[a_real_idx] != DUMMY_TAG) {
+        real_variable_tags[large_real_idx] = real_variable_tags[a_real_idx];
+    } else {
+        real_variable_tags[large_real_idx] = real_variable_tags[b_real_idx];
+    }
+    if (!relabel_b) {
+        variables[large_real_idx] = variables[a_real_idx];
+    }
 }
 
 /**
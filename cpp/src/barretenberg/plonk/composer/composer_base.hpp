@@ -508,6 +508,8 @@ extern template void ComposerBase::compute_sigma_permutations<4, true>(proving_k
  * vectors' entries for variables 6 & 7 to imply a copy-cycle between them. Arbitrarily, variables[7] is deemed the
  * "first" in the cycle and variables[6] is considered the last (and hence the "real" variable which represents the
  * cycle).
+ * When larger classes are joined, the smaller chain is inserted just before the real variable of the larger one, so
+ * that only the members of the smaller class need their `real_var_index` rewritten.
  *
  * By the time we get to computing wire copy-cycles, we need to allow for public_inputs, which in the plonk protocol
  * are positioned to be the first witness values. `variables` doesn't include these public inputs (they're stored
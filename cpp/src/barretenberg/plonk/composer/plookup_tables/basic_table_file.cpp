@@ -0,0 +1,177 @@
+#ifndef __wasm__
+#include "basic_table_file.hpp"
+#include "plookup_tables.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+namespace plookup {
+
+namespace {
+// A table read from the file has no generator to compute its values with, so any lookup by key is a bug.
+std::array<barretenberg::fr, 2> get_values_from_table_file(const std::array<uint64_t, 2>)
+{
+    throw_or_abort("Keyed lookup on a basic table read from a table file");
+}
+} // namespace
+
+uint64_t BasicTableFile::compute_fingerprint(BasicTable const& table)
+{
+    // FNV-1a over 64-bit words, of the fields that the file stores.
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    auto add = [&](void const* data, size_t size) {
+        auto const* words = static_cast<uint64_t const*>(data);
+        for (size_t i = 0; i < size / sizeof(uint64_t); ++i) {
+            hash = (hash ^ words[i]) * 0x100000001b3ULL;
+        }
+    };
+    const std::array<uint64_t, 2> shape{ table.size, table.use_twin_keys ? 1UL : 0UL };
+    add(shape.data(), sizeof(shape));
+    for (const auto* step_size : { &table.column_1_step_size, &table.column_2_step_size, &table.column_3_step_size }) {
+        add(step_size, sizeof(barretenberg::fr));
+    }
+    for (const auto column : { table.get_column_1(), table.get_column_2(), table.get_column_3() }) {
+        add(column.data(), column.size() * sizeof(barretenberg::fr));
+    }
+    return hash;
+}
+
+void BasicTableFile::write(std::string const& path)
+{
+    std::vector<Entry> entries(NUM_BASIC_TABLES);
+    std::vector<BasicTable> tables;
+    uint64_t offset = sizeof(Header) + sizeof(Entry) * NUM_BASIC_TABLES;
+    for (size_t i = 0; i < NUM_BASIC_TABLES; ++i) {
+        const auto id = static_cast<BasicTableId>(i);
+        std::memset((void*)&entries[i], 0, sizeof(Entry));
+        if (!has_basic_table_generator(id)) {
+            continue;
+        }
+        // Not `get_basic_table`, which may serve the table from the very file being replaced.
+        tables.emplace_back(create_basic_table(id, 0));
+        const auto& table = tables.back();
+        entries[i].offset = offset;
+        entries[i].size = table.size;
+        entries[i].use_twin_keys = table.use_twin_keys;
+        entries[i].fingerprint = compute_fingerprint(table);
+        entries[i].column_step_sizes = { table.column_1_step_size, table.column_2_step_size, table.column_3_step_size };
+        offset += 3 * table.size * sizeof(barretenberg::fr);
+    }
+    const Header header{ MAGIC, TABLE_FILE_VERSION, NUM_BASIC_TABLES, offset };
+
+    const std::string temp_path = path + ".tmp" + std::to_string(getpid());
+    {
+        std::ofstream file(temp_path, std::ofstream::binary);
+        file.write((char const*)&header, sizeof(header));
+        file.write((char const*)entries.data(), (std::streamsize)(sizeof(Entry) * entries.size()));
+        for (const auto& table : tables) {
+            for (const auto column : { table.get_column_1(), table.get_column_2(), table.get_column_3() }) {
+                file.write((char const*)column.data(), (std::streamsize)(table.size * sizeof(barretenberg::fr)));
+            }
+        }
+        if (!file) {
+            std::remove(temp_path.c_str());
+            throw_or_abort("Unable to write basic tables to " + temp_path);
+        }
+    }
+    if (std::rename(temp_path.c_str(), path.c_str()) != 0) {
+        std::remove(temp_path.c_str());
+        throw_or_abort("Unable to write basic tables to " + path + ": " + std::strerror(errno));
+    }
+}
+
+BasicTableFile::BasicTableFile(std::string const& path)
+{
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return;
+    }
+    struct stat st;
+    Header header;
+    const bool valid_header = fstat(fd, &st) == 0 && pread(fd, &header, sizeof(header), 0) == sizeof(header) &&
+                              header.magic == MAGIC && header.version == TABLE_FILE_VERSION &&
+                              header.num_tables == NUM_BASIC_TABLES &&
+                              header.file_size == static_cast<uint64_t>(st.st_size);
+    if (valid_header) {
+        void* data = mmap(nullptr, header.file_size, PROT_READ, MAP_SHARED, fd, 0);
+        if (data != MAP_FAILED) {
+            data_ = static_cast<uint8_t const*>(data);
+            size_ = header.file_size;
+        }
+    }
+    // The mapping stays valid after the descriptor is closed.
+    close(fd);
+}
+
+BasicTableFile::~BasicTableFile()
+{
+    if (data_ != nullptr) {
+        munmap((void*)data_, size_);
+    }
+}
+
+bool BasicTableFile::read(const BasicTableId id, BasicTable& table) const
+{
+    if (data_ == nullptr || id >= NUM_BASIC_TABLES) {
+        return false;
+    }
+    Entry entry;
+    std::memcpy((void*)&entry, data_ + sizeof(Header) + sizeof(Entry) * static_cast<size_t>(id), sizeof(Entry));
+    const uint64_t columns_size = 3 * entry.size * sizeof(barretenberg::fr);
+    if (entry.offset == 0 || entry.offset > size_ || columns_size > size_ - entry.offset) {
+        return false;
+    }
+
+    auto const* column = (barretenberg::fr const*)(data_ + entry.offset);
+    table.id = id;
+    table.table_index = 0;
+    table.size = entry.size;
+    table.use_twin_keys = entry.use_twin_keys != 0;
+    table.column_1_step_size = entry.column_step_sizes[0];
+    table.column_2_step_size = entry.column_step_sizes[1];
+    table.column_3_step_size = entry.column_step_sizes[2];
+    table.column_1.clear();
+    table.column_2.clear();
+    table.column_3.clear();
+    table.shared_columns = { std::span(column, entry.size),
+                             std::span(column + entry.size, entry.size),
+                             std::span(column + 2 * entry.size, entry.size) };
+    table.shared_columns_owner = shared_from_this();
+    table.lookup_gates.clear();
+    table.get_values_from_key = &get_values_from_table_file;
+    return true;
+}
+
+bool BasicTableFile::is_current() const
+{
+    if (data_ == nullptr) {
+        return false;
+    }
+    for (size_t i = 0; i < NUM_BASIC_TABLES; ++i) {
+        const auto id = static_cast<BasicTableId>(i);
+        Entry entry;
+        std::memcpy((void*)&entry, data_ + sizeof(Header) + sizeof(Entry) * i, sizeof(Entry));
+        if (!has_basic_table_generator(id)) {
+            if (entry.offset != 0) {
+                return false;
+            }
+            continue;
+        }
+        BasicTable table;
+        if (!read(id, table) || entry.fingerprint != compute_fingerprint(table) ||
+            entry.fingerprint != compute_fingerprint(create_basic_table(id, 0))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace plookup
+#endif
@@ -0,0 +1,89 @@
+#pragma once
+#ifndef __wasm__
+#include "types.hpp"
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace plookup {
+
+/**
+ * @brief A file holding the columns of every basic table, so that a process can map it instead of building them.
+ *
+ * @details The file is a header, then one entry per BasicTableId, then the columns:
+ *
+ *     [ header ][ entry 0 ] ... [ entry NUM_BASIC_TABLES - 1 ][ column_1 | column_2 | column_3 of a table ] ...
+ *
+ * Field elements are stored as they are in memory, in Montgomery form, so the file can only be read on a machine with
+ * the same byte order. It is mapped read-only, and a table's columns are only paged in when it is first used. Tables
+ * read from the file view their columns in the mapping, so a BasicTableFile must be owned by a std::shared_ptr.
+ *
+ * Each entry holds a fingerprint of the table it was written from. The file does not describe how the tables were
+ * generated, so a file written before a table generator changed can only be told apart by generating the tables
+ * again and comparing fingerprints, which `is_current()` does. That costs as much as building the tables, so it is
+ * left to `enable_basic_table_file` and the `write_basic_tables` tool; `use_basic_table_file` trusts the file.
+ */
+class BasicTableFile : public std::enable_shared_from_this<BasicTableFile> {
+  public:
+    /**
+     * @brief Build every basic table and write them to `path`. The file is written next to `path` and then renamed,
+     * so that processes reading `path` never see a partial file.
+     */
+    static void write(std::string const& path);
+
+    /**
+     * @brief Map the file at `path`. Check `is_valid()`: the file may be missing, truncated or from another version.
+     */
+    explicit BasicTableFile(std::string const& path);
+    ~BasicTableFile();
+
+    BasicTableFile(BasicTableFile const& other) = delete;
+    BasicTableFile(BasicTableFile&& other) = delete;
+    BasicTableFile& operator=(BasicTableFile const& other) = delete;
+    BasicTableFile& operator=(BasicTableFile&& other) = delete;
+
+    bool is_valid() const { return data_ != nullptr; }
+
+    /**
+     * @brief Read basic table `id` into `table`, with table index 0, as views of the columns in the file that keep the
+     * file alive. Returns false if the file does not hold it.
+     */
+    bool read(const BasicTableId id, BasicTable& table) const;
+
+    /**
+     * @brief Whether the file holds exactly the tables that this build generates. Builds every table to check.
+     */
+    bool is_current() const;
+
+    /**
+     * @brief A hash of the columns, size and step sizes of `table`.
+     */
+    static uint64_t compute_fingerprint(BasicTable const& table);
+
+  private:
+    struct Header {
+        uint64_t magic;
+        uint64_t version;
+        uint64_t num_tables;
+        uint64_t file_size;
+    };
+
+    struct Entry {
+        // Offset of the table's columns from the start of the file, or 0 if the table is not in the file.
+        uint64_t offset;
+        uint64_t size;
+        uint64_t use_twin_keys;
+        uint64_t fingerprint;
+        std::array<barretenberg::fr, 3> column_step_sizes;
+    };
+
+    static constexpr uint64_t MAGIC = 0x454c4241544b4c50ULL; // "PLKTABLE"
+    static constexpr uint64_t TABLE_FILE_VERSION = 2;
+
+    uint8_t const* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+} // namespace plookup
+#endif
@@ -1,16 +1,20 @@
 #include "plookup_tables.hpp"
+#include "basic_table_file.hpp"
 #include "barretenberg/common/constexpr_utils.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include <memory>
+#ifndef __wasm__
+#include <mutex>
+#endif
 
 namespace plookup {
 
 using namespace barretenberg;
 
 namespace {
-static std::array<MultiTable, MultiTableId::NUM_MULTI_TABLES> MULTI_TABLES;
-static bool inited = false;
-
-void init_multi_tables()
+std::array<MultiTable, MultiTableId::NUM_MULTI_TABLES> init_multi_tables()
 {
+    std::array<MultiTable, MultiTableId::NUM_MULTI_TABLES> MULTI_TABLES;
     MULTI_TABLES[MultiTableId::SHA256_CH_INPUT] = sha256_tables::get_choose_input_table(MultiTableId::SHA256_CH_INPUT);
     MULTI_TABLES[MultiTableId::SHA256_MAJ_INPUT] =
         sha256_tables::get_majority_input_table(MultiTableId::SHA256_MAJ_INPUT);
@@ -96,18 +100,108 @@ void init_multi_tables()
         MULTI_TABLES[(size_t)MultiTableId::KECCAK_NORMALIZE_AND_ROTATE + i] =
             keccak_tables::Rho<8, i>::get_rho_output_table(MultiTableId::KECCAK_NORMALIZE_AND_ROTATE);
     });
+    return MULTI_TABLES;
+}
+
+// Basic tables built or read so far, shared by every composer.
+std::array<std::shared_ptr<const BasicTable>, NUM_BASIC_TABLES> basic_tables;
+#ifndef __wasm__
+std::shared_ptr<const BasicTableFile> basic_table_file;
+std::string basic_table_file_path;
+std::mutex basic_tables_mutex;
+#endif
+
+/**
+ * Returns a copy of `table` with table index `index` whose columns view those of `table`, and keep alive whatever
+ * owns them: the file they were read from, or `table` itself.
+ */
+BasicTable share_basic_table(std::shared_ptr<const BasicTable> const& table, const size_t index)
+{
+    BasicTable result;
+    result.id = table->id;
+    result.table_index = index;
+    result.size = table->size;
+    result.use_twin_keys = table->use_twin_keys;
+    result.column_1_step_size = table->column_1_step_size;
+    result.column_2_step_size = table->column_2_step_size;
+    result.column_3_step_size = table->column_3_step_size;
+    result.get_values_from_key = table->get_values_from_key;
+    result.shared_columns = { table->get_column_1(), table->get_column_2(), table->get_column_3() };
+    result.shared_columns_owner = table->shared_columns_owner ? table->shared_columns_owner : table;
+    return result;
 }
 } // namespace
 
 const MultiTable& create_table(const MultiTableId id)
 {
-    if (!inited) {
-        init_multi_tables();
-        inited = true;
-    }
+    // Built on first use; a function-local static, so that threads building circuits concurrently build it once.
+    static const std::array<MultiTable, MultiTableId::NUM_MULTI_TABLES> MULTI_TABLES = init_multi_tables();
     return MULTI_TABLES[id];
 }
 
+BasicTable get_basic_table(const BasicTableId id, const size_t index)
+{
+    std::shared_ptr<const BasicTable> table;
+    {
+#ifndef __wasm__
+        std::lock_guard<std::mutex> lock(basic_tables_mutex);
+#endif
+        table = basic_tables[id];
+        if (table == nullptr) {
+            auto built = std::make_shared<BasicTable>();
+#ifndef __wasm__
+            if (basic_table_file == nullptr || !basic_table_file->read(id, *built)) {
+                *built = create_basic_table(id, 0);
+            }
+#else
+            *built = create_basic_table(id, 0);
+#endif
+            table = basic_tables[id] = built;
+        }
+    }
+    return share_basic_table(table, index);
+}
+
+#ifndef __wasm__
+std::string get_basic_table_file_path(std::string const& crs_path)
+{
+    return crs_path + "/plookup_basic_tables.dat";
+}
+
+bool use_basic_table_file(std::string const& path)
+{
+    {
+        std::lock_guard<std::mutex> lock(basic_tables_mutex);
+        if (basic_table_file != nullptr && basic_table_file_path == path) {
+            return true;
+        }
+    }
+    auto file = std::make_shared<const BasicTableFile>(path);
+    if (!file->is_valid()) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(basic_tables_mutex);
+    basic_table_file = std::move(file);
+    basic_table_file_path = path;
+    return true;
+}
+
+void enable_basic_table_file(std::string const& path)
+{
+    auto file = std::make_shared<const BasicTableFile>(path);
+    if (!file->is_current()) {
+        BasicTableFile::write(path);
+        file = std::make_shared<const BasicTableFile>(path);
+        if (!file->is_valid()) {
+            throw_or_abort("Unable to read basic tables from " + path);
+        }
+    }
+    std::lock_guard<std::mutex> lock(basic_tables_mutex);
+    basic_table_file = std::move(file);
+    basic_table_file_path = path;
+}
+#endif
+
 ReadData<barretenberg::fr> get_lookup_accumulators(const MultiTableId id,
                                                    const fr& key_a,
                                                    const fr& key_b,
@@ -0,0 +1,135 @@
+#include "plookup_tables.hpp"
+#include "basic_table_file.hpp"
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+using namespace barretenberg;
+using namespace plookup;
+
+namespace {
+void expect_tables_eq(const BasicTable& expected, const BasicTable& actual)
+{
+    EXPECT_EQ(actual.id, expected.id);
+    EXPECT_EQ(actual.table_index, expected.table_index);
+    EXPECT_EQ(actual.size, expected.size);
+    EXPECT_EQ(actual.use_twin_keys, expected.use_twin_keys);
+    EXPECT_EQ(actual.column_1_step_size, expected.column_1_step_size);
+    EXPECT_EQ(actual.column_2_step_size, expected.column_2_step_size);
+    EXPECT_EQ(actual.column_3_step_size, expected.column_3_step_size);
+    const auto to_vector = [](std::span<const fr> column) { return std::vector<fr>(column.begin(), column.end()); };
+    EXPECT_EQ(to_vector(actual.get_column_1()), to_vector(expected.get_column_1()));
+    EXPECT_EQ(to_vector(actual.get_column_2()), to_vector(expected.get_column_2()));
+    EXPECT_EQ(to_vector(actual.get_column_3()), to_vector(expected.get_column_3()));
+}
+
+class plookup_basic_table_file : public ::testing::Test {
+  protected:
+    void SetUp() override
+    {
+        auto const* test = ::testing::UnitTest::GetInstance()->current_test_info();
+        path = (std::filesystem::temp_directory_path() /
+                (std::string("basic_tables_") + test->name() + "_" + std::to_string(getpid())))
+                   .string();
+        std::filesystem::remove(path);
+    }
+
+    void TearDown() override { std::filesystem::remove(path); }
+
+    std::string path;
+};
+} // namespace
+
+TEST(plookup_tables, get_basic_table_matches_create_basic_table)
+{
+    for (const auto id : { UINT_XOR_ROTATE0, AES_SPARSE_MAP, PEDERSEN_0, BN254_XLO_BASIC, KECCAK_INPUT }) {
+        const auto expected = create_basic_table(id, 3);
+        const auto table = get_basic_table(id, 3);
+        expect_tables_eq(expected, table);
+        EXPECT_EQ(get_basic_table(id, 5).table_index, 5UL);
+    }
+}
+
+TEST(plookup_tables, get_basic_table_shares_columns)
+{
+    const auto table = get_basic_table(UINT_XOR_ROTATE0, 0);
+    const auto other = get_basic_table(UINT_XOR_ROTATE0, 1);
+    EXPECT_TRUE(table.column_1.empty());
+    EXPECT_EQ(table.get_column_1().data(), other.get_column_1().data());
+    EXPECT_EQ(table.get_column_2().data(), other.get_column_2().data());
+    EXPECT_EQ(table.get_column_3().data(), other.get_column_3().data());
+}
+
+TEST_F(plookup_basic_table_file, round_trip)
+{
+    BasicTableFile::write(path);
+    auto file = std::make_shared<const BasicTableFile>(path);
+    ASSERT_TRUE(file->is_valid());
+
+    for (size_t i = 0; i < NUM_BASIC_TABLES; ++i) {
+        const auto id = static_cast<BasicTableId>(i);
+        BasicTable table;
+        if (!has_basic_table_generator(id)) {
+            EXPECT_FALSE(file->read(id, table));
+            EXPECT_THROW(create_basic_table(id, 0), std::runtime_error);
+            continue;
+        }
+        ASSERT_TRUE(file->read(id, table));
+        expect_tables_eq(create_basic_table(id, 0), table);
+        // Values can only be read through the multi tables.
+        EXPECT_THROW(table.get_values_from_key({ 0, 0 }), std::runtime_error);
+    }
+    EXPECT_TRUE(file->is_current());
+
+    // The tables view the mapping, which they keep alive.
+    BasicTable table;
+    ASSERT_TRUE(file->read(UINT_XOR_ROTATE0, table));
+    file.reset();
+    expect_tables_eq(create_basic_table(UINT_XOR_ROTATE0, 0), table);
+}
+
+TEST_F(plookup_basic_table_file, rejects_missing_and_corrupt_files)
+{
+    EXPECT_FALSE(BasicTableFile(path).is_valid());
+    EXPECT_FALSE(use_basic_table_file(path));
+
+    BasicTableFile::write(path);
+    const auto size = std::filesystem::file_size(path);
+    std::filesystem::resize_file(path, size - 1);
+    EXPECT_FALSE(BasicTableFile(path).is_valid());
+
+    BasicTableFile::write(path);
+    {
+        // Overwrite the magic number.
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.write("garbage!", 8);
+    }
+    EXPECT_FALSE(BasicTableFile(path).is_valid());
+    EXPECT_FALSE(use_basic_table_file(path));
+
+    // Enabling the file rewrites it.
+    enable_basic_table_file(path);
+    EXPECT_TRUE(std::make_shared<BasicTableFile>(path)->is_valid());
+    EXPECT_EQ(std::filesystem::file_size(path), size);
+    EXPECT_TRUE(use_basic_table_file(path));
+}
+
+TEST_F(plookup_basic_table_file, rejects_stale_tables)
+{
+    BasicTableFile::write(path);
+    {
+        // Change the last value of the last table, as a generator change would.
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(-static_cast<std::streamoff>(sizeof(fr)), std::ios::end);
+        const fr value = fr::random_element();
+        file.write((char const*)&value, sizeof(value));
+    }
+    // The file is well formed, so it can be used, but it no longer matches the generated tables.
+    EXPECT_TRUE(std::make_shared<BasicTableFile>(path)->is_valid());
+    EXPECT_FALSE(std::make_shared<BasicTableFile>(path)->is_current());
+
+    // Enabling the file checks it and rewrites it.
+    enable_basic_table_file(path);
+    EXPECT_TRUE(std::make_shared<BasicTableFile>(path)->is_current());
+}
@@ -2,6 +2,8 @@
 
 #include <vector>
 #include <array>
+#include <memory>
+#include <span>
 
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 
@@ -97,6 +99,7 @@ enum BasicTableId {
     KECCAK_RHO_7,
     KECCAK_RHO_8,
     KECCAK_RHO_9,
+    NUM_BASIC_TABLES,
 };
 
 enum MultiTableId {
@@ -317,6 +320,24 @@ struct BasicTable {
     std::vector<KeyEntry> lookup_gates;
 
     std::array<barretenberg::fr, 2> (*get_values_from_key)(const std::array<uint64_t, 2>);
+
+    // Set instead of column_1, column_2 and column_3 when the columns are shared with other tables (see
+    // `plookup::get_basic_table`): views of the columns, and the object that keeps them alive.
+    std::array<std::span<const barretenberg::fr>, 3> shared_columns;
+    std::shared_ptr<const void> shared_columns_owner;
+
+    std::span<const barretenberg::fr> get_column_1() const
+    {
+        return shared_columns_owner ? shared_columns[0] : std::span<const barretenberg::fr>(column_1);
+    }
+    std::span<const barretenberg::fr> get_column_2() const
+    {
+        return shared_columns_owner ? shared_columns[1] : std::span<const barretenberg::fr>(column_2);
+    }
+    std::span<const barretenberg::fr> get_column_3() const
+    {
+        return shared_columns_owner ? shared_columns[2] : std::span<const barretenberg::fr>(column_3);
+    }
 };
 
 enum ColumnIdx { C1, C2, C3 };
@@ -79,27 +79,30 @@ void UltraPlonkComposerHelper<CircuitConstructor>::compute_witness(CircuitConstr
     for (auto& table : circuit_constructor.lookup_tables) {
         const fr table_index(table.table_index);
         auto& lookup_gates = table.lookup_gates;
+        const auto column_1 = table.get_column_1();
+        const auto column_2 = table.get_column_2();
+        const auto column_3 = table.get_column_3();
         for (size_t i = 0; i < table.size; ++i) {
             if (table.use_twin_keys) {
                 lookup_gates.push_back({
                     {
-                        table.column_1[i].from_montgomery_form().data[0],
-                        table.column_2[i].from_montgomery_form().data[0],
+                        column_1[i].from_montgomery_form().data[0],
+                        column_2[i].from_montgomery_form().data[0],
                     },
                     {
-                        table.column_3[i],
+                        column_3[i],
                         0,
                     },
                 });
             } else {
                 lookup_gates.push_back({
                     {
-                        table.column_1[i].from_montgomery_form().data[0],
+                        column_1[i].from_montgomery_form().data[0],
                         0,
                     },
                     {
-                        table.column_2[i],
-                        table.column_3[i],
+                        column_2[i],
+                        column_3[i],
                     },
                 });
             }
@@ -267,10 +270,13 @@ std::shared_ptr<proving_key> UltraPlonkComposerHelper<CircuitConstructor>::compu
     for (const auto& table : circuit_constructor.lookup_tables) {
         const fr table_index(table.table_index);
 
+        const auto column_1 = table.get_column_1();
+        const auto column_2 = table.get_column_2();
+        const auto column_3 = table.get_column_3();
         for (size_t i = 0; i < table.size; ++i) {
-            poly_q_table_column_1[offset] = table.column_1[i];
-            poly_q_table_column_2[offset] = table.column_2[i];
-            poly_q_table_column_3[offset] = table.column_3[i];
+            poly_q_table_column_1[offset] = column_1[i];
+            poly_q_table_column_2[offset] = column_2[i];
+            poly_q_table_column_3[offset] = column_3[i];
             poly_q_table_column_4[offset] = table_index;
             ++offset;
         }
@@ -540,4 +540,34 @@ TEST(standard_composer, test_check_circuit_broken)
     bool result = composer.check_circuit();
     EXPECT_EQ(result, false);
 }
+
+TEST(standard_composer, assert_equal_smaller_class_first)
+{
+    StandardComposer composer = StandardComposer();
+    const fr a_value = fr::random_element();
+    const fr b_value = a_value + 1;
+    const uint32_t a_idx = composer.add_variable(a_value);
+    std::vector<uint32_t> b_indices;
+    for (size_t i = 0; i < 5; ++i) {
+        b_indices.push_back(composer.add_variable(b_value));
+        if (i > 0) {
+            composer.assert_equal(b_indices[i], b_indices[0]);
+        }
+    }
+    const uint32_t b_real_idx = composer.real_variable_index[b_indices[0]];
+    composer.real_variable_tags[composer.real_variable_index[a_idx]] = 7;
+    EXPECT_EQ(composer.failed(), false);
+
+    // a's class is the smaller one, so it is relabelled into b's, but the merged class keeps a's value and tag.
+    composer.assert_equal(a_idx, b_indices[3], "values differ");
+    EXPECT_EQ(composer.failed(), true);
+    EXPECT_EQ(composer.err(), "values differ");
+    EXPECT_EQ(composer.real_variable_index[a_idx], b_real_idx);
+    EXPECT_EQ(composer.get_variable(a_idx), a_value);
+    for (auto idx : b_indices) {
+        EXPECT_EQ(composer.real_variable_index[idx], b_real_idx);
+        EXPECT_EQ(composer.get_variable(idx), a_value);
+    }
+    EXPECT_EQ(composer.real_variable_tags[b_real_idx], 7U);
+}
 } // namespace proof_system::plonk
@@ -590,10 +590,13 @@ std::shared_ptr<proving_key> UltraComposer::compute_proving_key()
     for (const auto& table : lookup_tables) {
         const fr table_index(table.table_index);
 
+        const auto column_1 = table.get_column_1();
+        const auto column_2 = table.get_column_2();
+        const auto column_3 = table.get_column_3();
         for (size_t i = 0; i < table.size; ++i) {
-            poly_q_table_column_1[offset] = table.column_1[i];
-            poly_q_table_column_2[offset] = table.column_2[i];
-            poly_q_table_column_3[offset] = table.column_3[i];
+            poly_q_table_column_1[offset] = column_1[i];
+            poly_q_table_column_2[offset] = column_2[i];
+            poly_q_table_column_3[offset] = column_3[i];
             poly_q_table_column_4[offset] = table_index;
             ++offset;
         }
@@ -743,27 +746,30 @@ void UltraComposer::compute_witness()
     for (auto& table : lookup_tables) {
         const fr table_index(table.table_index);
         auto& lookup_gates = table.lookup_gates;
+        const auto column_1 = table.get_column_1();
+        const auto column_2 = table.get_column_2();
+        const auto column_3 = table.get_column_3();
         for (size_t i = 0; i < table.size; ++i) {
             if (table.use_twin_keys) {
                 lookup_gates.push_back({
                     {
-                        table.column_1[i].from_montgomery_form().data[0],
-                        table.column_2[i].from_montgomery_form().data[0],
+                        column_1[i].from_montgomery_form().data[0],
+                        column_2[i].from_montgomery_form().data[0],
                     },
                     {
-                        table.column_3[i],
+                        column_3[i],
                         0,
                     },
                 });
             } else {
                 lookup_gates.push_back({
                     {
-                        table.column_1[i].from_montgomery_form().data[0],
+                        column_1[i].from_montgomery_form().data[0],
                         0,
                     },
                     {
-                        table.column_2[i],
-                        table.column_3[i],
+                        column_2[i],
+                        column_3[i],
                     },
                 });
             }
@@ -1001,7 +1007,7 @@ plookup::BasicTable& UltraComposer::get_table(const plookup::BasicTableId id)
         }
     }
     // Table doesn't exist! So try to create it.
-    lookup_tables.emplace_back(plookup::create_basic_table(id, lookup_tables.size()));
+    lookup_tables.emplace_back(plookup::get_basic_table(id, lookup_tables.size()));
     return lookup_tables[lookup_tables.size() - 1];
 }
 
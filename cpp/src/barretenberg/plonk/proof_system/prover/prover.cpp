@@ -404,20 +404,38 @@ template <typename settings> void ProverBase<settings>::execute_fourth_round()
     compute_lagrange_1_fft();
 
     for (auto& widget : random_widgets) {
+        alpha_base = widget->prepare_quotient_contribution(alpha_base, transcript);
+    }
+    for (auto& widget : transition_widgets) {
+        alpha_base = widget->prepare_quotient_contribution(alpha_base, transcript);
+    }
+
 #ifdef DEBUG_TIMING
-        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    start = std::chrono::steady_clock::now();
 #endif
-        alpha_base = widget->compute_quotient_contribution(alpha_base, transcript);
-#ifdef DEBUG_TIMING
-        std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
-        std::chrono::milliseconds diff = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
-        std::cerr << "widget " << i << " quotient compute time: " << diff.count() << "ms" << std::endl;
+    // Compute the widgets' contributions one block of the large domain at a time, so that the polynomials the widgets
+    // share, and the quotient they all add to, are read from cache rather than memory by all but the first widget.
+    // The permutation widget comes first and initialises the quotient.
+    const size_t block_size = std::min(quotient_block_size, key->large_domain.size);
+    const size_t num_blocks = key->large_domain.size / block_size;
+#ifndef NO_MULTITHREADING
+#pragma omp parallel for schedule(static)
 #endif
+    for (size_t j = 0; j < num_blocks; ++j) {
+        const size_t block_start = j * block_size;
+        const size_t block_end = block_start + block_size;
+        for (auto& widget : random_widgets) {
+            widget->accumulate_quotient_contribution(block_start, block_end);
+        }
+        for (auto& widget : transition_widgets) {
+            widget->accumulate_quotient_contribution(block_start, block_end);
+        }
     }
-
-    for (auto& widget : transition_widgets) {
-        alpha_base = widget->compute_quotient_contribution(alpha_base, transcript);
-    }
+#ifdef DEBUG_TIMING
+    end = std::chrono::steady_clock::now();
+    diff = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+    std::cerr << "compute quotient contributions: " << diff.count() << "ms" << std::endl;
+#endif
 #ifdef DEBUG_TIMING
     start = std::chrono::steady_clock::now();
 #endif
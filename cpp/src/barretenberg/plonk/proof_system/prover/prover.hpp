@@ -96,6 +96,10 @@ template <typename settings> class ProverBase {
     work_queue queue;
 
   private:
+    // Number of points of the large domain each widget computes its quotient contribution over before the next widget
+    // takes over; small enough for the polynomials of a block to stay in cache between widgets.
+    static constexpr size_t quotient_block_size = 1UL << 10;
+
     plonk::proof proof;
 };
 extern template class ProverBase<standard_settings>;
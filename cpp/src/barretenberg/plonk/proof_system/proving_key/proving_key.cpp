@@ -31,7 +31,9 @@ proving_key::proving_key(const size_t num_gates,
     , log_circuit_size(numeric::get_msb(num_gates))
     , num_public_inputs(num_inputs)
     , small_domain(circuit_size, circuit_size)
-    , large_domain(4 * circuit_size, circuit_size > min_thread_block ? circuit_size : 4 * circuit_size)
+    , large_domain(4 * circuit_size,
+                   circuit_size > min_thread_block ? circuit_size : 4 * circuit_size,
+                   get_large_domain_fft_algorithm(4 * circuit_size))
     , reference_string(crs)
     , pippenger_runtime_state(circuit_size + 1)
     , polynomial_manifest((uint32_t)type)
@@ -51,11 +53,13 @@ proving_key::proving_key(proving_key_data&& data, std::shared_ptr<proof_system::
     , num_public_inputs(data.num_public_inputs)
     , contains_recursive_proof(data.contains_recursive_proof)
     , recursive_proof_public_input_indices(std::move(data.recursive_proof_public_input_indices))
-    , memory_read_records(data.memory_read_records)
-    , memory_write_records(data.memory_write_records)
-    , polynomial_store(data.polynomial_store)
+    , memory_read_records(std::move(data.memory_read_records))
+    , memory_write_records(std::move(data.memory_write_records))
+    , polynomial_store(std::move(data.polynomial_store))
     , small_domain(circuit_size, circuit_size)
-    , large_domain(4 * circuit_size, circuit_size > min_thread_block ? circuit_size : 4 * circuit_size)
+    , large_domain(4 * circuit_size,
+                   circuit_size > min_thread_block ? circuit_size : 4 * circuit_size,
+                   get_large_domain_fft_algorithm(4 * circuit_size))
     , reference_string(crs)
     , pippenger_runtime_state(circuit_size + 1)
     , polynomial_manifest(data.composer_type)
@@ -67,6 +67,19 @@ struct proving_key {
     PolynomialManifest polynomial_manifest;
 
     static constexpr size_t min_thread_block = 4UL;
+
+    // The FFT used for the large domain of proving keys constructed from now on. RADIX_2 by default: four-step is
+    // opt-in, as it has not yet been measured to beat radix-2 at any domain size.
+    static inline barretenberg::FFTAlgorithm large_domain_fft_algorithm = barretenberg::FFTAlgorithm::RADIX_2;
+
+    // Large domains smaller than this fit in cache, so they use radix-2 even if four-step is selected.
+    static constexpr size_t min_four_step_fft_size = 1UL << 20;
+
+    static barretenberg::FFTAlgorithm get_large_domain_fft_algorithm(const size_t large_domain_size)
+    {
+        return large_domain_size >= min_four_step_fft_size ? large_domain_fft_algorithm
+                                                           : barretenberg::FFTAlgorithm::RADIX_2;
+    }
 };
 
 } // namespace proof_system::plonk
@@ -3,15 +3,33 @@
 #include "proving_key.hpp"
 #include "serialize.hpp"
 #include "barretenberg/plonk/composer/standard_composer.hpp"
+#include "barretenberg/plonk/composer/turbo_composer.hpp"
 #include "barretenberg/plonk/composer/ultra_composer.hpp"
 
 #ifndef __wasm__
+#include "proving_key_file.hpp"
+#include <algorithm>
+#include <cstring>
 #include <filesystem>
+#include <fstream>
+#include <unistd.h>
 #endif
 
 using namespace barretenberg;
 using namespace proof_system;
 
+TEST(proving_key, large_domain_uses_radix_2_unless_four_step_is_selected)
+{
+    using plonk::proving_key;
+    const size_t large = proving_key::min_four_step_fft_size;
+    EXPECT_EQ(proving_key::get_large_domain_fft_algorithm(large), FFTAlgorithm::RADIX_2);
+
+    proving_key::large_domain_fft_algorithm = FFTAlgorithm::FOUR_STEP;
+    EXPECT_EQ(proving_key::get_large_domain_fft_algorithm(large), FFTAlgorithm::FOUR_STEP);
+    EXPECT_EQ(proving_key::get_large_domain_fft_algorithm(large / 2), FFTAlgorithm::RADIX_2);
+    proving_key::large_domain_fft_algorithm = FFTAlgorithm::RADIX_2;
+}
+
 // Test proving key serialization/deserialization to/from buffer
 TEST(proving_key, proving_key_from_serialized_key)
 {
@@ -150,4 +168,129 @@ TEST(proving_key, proving_key_from_mmaped_key)
     EXPECT_EQ(p_key.num_public_inputs, pk_data.num_public_inputs);
     EXPECT_EQ(p_key.contains_recursive_proof, pk_data.contains_recursive_proof);
 }
+
+namespace {
+std::string get_proving_key_file_path()
+{
+    auto const* test = ::testing::UnitTest::GetInstance()->current_test_info();
+    return (std::filesystem::temp_directory_path() /
+            (std::string("proving_key_") + test->name() + "_" + std::to_string(getpid())))
+        .string();
+}
+
+// Build a small circuit, write its proving key to a file, and prove with a fresh composer that maps the key.
+template <typename Composer> bool prove_with_proving_key_file()
+{
+    const std::string path = get_proving_key_file_path();
+    Composer composer = Composer();
+    fr a = fr::one();
+    composer.add_public_variable(a);
+    auto verification_key = composer.compute_verification_key();
+    plonk::write_proving_key_file(path, *composer.compute_proving_key());
+
+    auto pk_data = plonk::read_proving_key_file(path);
+    std::filesystem::remove(path);
+    auto crs = std::make_unique<FileReferenceStringFactory>("../srs_db/ignition");
+    const size_t circuit_size = pk_data.circuit_size;
+    auto proving_key = std::make_shared<plonk::proving_key>(std::move(pk_data), crs->get_prover_crs(circuit_size + 1));
+
+    Composer composer2 = Composer(proving_key, verification_key);
+    composer2.add_public_variable(a);
+    auto prover = composer2.create_prover();
+    auto verifier = composer2.create_verifier();
+    plonk::proof proof = prover.construct_proof();
+    return verifier.verify_proof(proof);
+}
+} // namespace
+
+TEST(proving_key, proving_key_file_round_trip)
+{
+    const std::string path = get_proving_key_file_path();
+    plonk::UltraComposer composer = plonk::UltraComposer();
+    fr a = fr::one();
+    composer.add_public_variable(a);
+    plonk::proving_key& p_key = *composer.compute_proving_key();
+    plonk::write_proving_key_file(path, p_key);
+
+    auto pk_data = plonk::read_proving_key_file(path);
+    std::filesystem::remove(path);
+
+    EXPECT_EQ(pk_data.polynomial_store.size(), p_key.polynomial_store.size());
+    for (auto const& [label, polynomial] : p_key.polynomial_store) {
+        auto& output_poly = pk_data.polynomial_store.get(label);
+        EXPECT_EQ(output_poly, polynomial);
+        EXPECT_EQ(output_poly.backing_memory_ != nullptr, true);
+        // Polynomials are writable; writes are private to the process.
+        if (!output_poly.is_empty()) {
+            output_poly[0] += fr::one();
+            EXPECT_EQ(output_poly[0], polynomial[0] + fr::one());
+        }
+    }
+    EXPECT_EQ(p_key.composer_type, pk_data.composer_type);
+    EXPECT_EQ(p_key.circuit_size, pk_data.circuit_size);
+    EXPECT_EQ(p_key.num_public_inputs, pk_data.num_public_inputs);
+    EXPECT_EQ(p_key.contains_recursive_proof, pk_data.contains_recursive_proof);
+    EXPECT_EQ(p_key.memory_read_records, pk_data.memory_read_records);
+    EXPECT_EQ(p_key.memory_write_records, pk_data.memory_write_records);
+}
+
+TEST(proving_key, proving_key_file_rejects_invalid_files)
+{
+    const std::string path = get_proving_key_file_path();
+    EXPECT_THROW(plonk::read_proving_key_file(path), std::runtime_error);
+
+    plonk::StandardComposer composer = plonk::StandardComposer();
+    composer.add_public_variable(fr::one());
+    plonk::write_proving_key_file(path, *composer.compute_proving_key());
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+    EXPECT_THROW(plonk::read_proving_key_file(path), std::runtime_error);
+    std::filesystem::remove(path);
+}
+
+TEST(proving_key, proving_key_file_rejects_corrupt_label_length)
+{
+    const std::string path = get_proving_key_file_path();
+    plonk::StandardComposer composer = plonk::StandardComposer();
+    composer.add_public_variable(fr::one());
+    auto& p_key = *composer.compute_proving_key();
+    plonk::write_proving_key_file(path, p_key);
+    std::vector<std::string> labels;
+    for (auto const& [label, polynomial] : p_key.polynomial_store) {
+        labels.push_back(label);
+    }
+    const std::string first_label = *std::min_element(labels.begin(), labels.end());
+
+    std::vector<uint8_t> original;
+    {
+        std::ifstream file(path, std::ifstream::binary);
+        original.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    // The label is written after its big-endian length. The header holds the metadata size at bytes 16 to 24.
+    const auto label_it = std::search(original.begin() + 32, original.end(), first_label.begin(), first_label.end());
+    ASSERT_NE(label_it, original.end());
+    const auto length_offset = static_cast<size_t>(label_it - original.begin()) - sizeof(uint32_t);
+    uint64_t metadata_size = 0;
+    std::memcpy(&metadata_size, &original[16], sizeof(metadata_size));
+
+    // A length that runs past the metadata but not the file, and one that runs past the file.
+    for (const uint32_t length : { static_cast<uint32_t>(metadata_size), UINT32_MAX }) {
+        auto corrupt = original;
+        for (size_t i = 0; i < sizeof(uint32_t); ++i) {
+            corrupt[length_offset + i] = static_cast<uint8_t>(length >> (24 - 8 * i));
+        }
+        {
+            std::ofstream file(path, std::ofstream::binary);
+            file.write((char const*)corrupt.data(), (std::streamsize)corrupt.size());
+        }
+        EXPECT_THROW(plonk::read_proving_key_file(path), std::runtime_error);
+    }
+    std::filesystem::remove(path);
+}
+
+TEST(proving_key, proving_key_file_proofs)
+{
+    EXPECT_TRUE(prove_with_proving_key_file<plonk::StandardComposer>());
+    EXPECT_TRUE(prove_with_proving_key_file<plonk::TurboComposer>());
+    EXPECT_TRUE(prove_with_proving_key_file<plonk::UltraComposer>());
+}
 #endif
@@ -0,0 +1,248 @@
+#ifndef __wasm__
+#include "proving_key_file.hpp"
+#include "barretenberg/common/serialize.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+namespace proof_system::plonk {
+
+namespace {
+constexpr uint64_t PROVING_KEY_FILE_MAGIC = 0x59454b474e4b4c50ULL; // "PLKNGKEY"
+constexpr size_t PAGE_SIZE = 4096;
+
+struct proving_key_file_header {
+    uint64_t magic;
+    uint64_t version;
+    uint64_t metadata_size;
+    uint64_t file_size;
+};
+
+struct polynomial_entry {
+    std::string label;
+    uint64_t size;
+    uint64_t offset;
+};
+
+size_t round_up_to_page(const size_t size)
+{
+    return (size + PAGE_SIZE - 1) & ~(PAGE_SIZE - 1);
+}
+
+size_t get_polynomial_bytes(const size_t size)
+{
+    return (size + 1) * sizeof(barretenberg::fr);
+}
+
+// The metadata is written and read with the serialize primitives for integers, and with a length-prefix for vectors
+// and strings, so that the reader can check every length against the bytes left before using it.
+template <typename T> std::enable_if_t<std::is_integral_v<T>> write_field(std::vector<uint8_t>& buf, T value)
+{
+    serialize::write(buf, value);
+}
+
+template <typename T> void write_field(std::vector<uint8_t>& buf, std::vector<T> const& value)
+{
+    write_field(buf, static_cast<uint32_t>(value.size()));
+    for (auto const& element : value) {
+        write_field(buf, element);
+    }
+}
+
+void write_field(std::vector<uint8_t>& buf, std::string const& value)
+{
+    write_field(buf, static_cast<uint32_t>(value.size()));
+    buf.insert(buf.end(), value.begin(), value.end());
+}
+
+/**
+ * Reads the metadata of a proving key file, throwing rather than reading past the end of the metadata.
+ */
+class metadata_reader {
+  public:
+    metadata_reader(uint8_t const* begin, uint8_t const* end, std::string const& path)
+        : it_(begin)
+        , end_(end)
+        , path_(path)
+    {}
+
+    template <typename T> std::enable_if_t<std::is_integral_v<T>> read(T& value)
+    {
+        check_remaining(sizeof(T));
+        serialize::read(it_, value);
+    }
+
+    template <typename T> void read(std::vector<T>& value)
+    {
+        uint32_t size = 0;
+        read(size);
+        check_remaining(size * sizeof(T));
+        value.resize(size);
+        for (auto& element : value) {
+            read(element);
+        }
+    }
+
+    void read(std::string& value)
+    {
+        uint32_t size = 0;
+        read(size);
+        check_remaining(size);
+        value.assign(reinterpret_cast<char const*>(it_), size);
+        it_ += size;
+    }
+
+    bool at_end() const { return it_ == end_; }
+
+  private:
+    void check_remaining(const size_t num_bytes) const
+    {
+        if (num_bytes > static_cast<size_t>(end_ - it_)) {
+            throw_or_abort("Invalid metadata in proving key file " + path_);
+        }
+    }
+
+    uint8_t const* it_;
+    uint8_t const* end_;
+    std::string const& path_;
+};
+} // namespace
+
+void write_proving_key_file(std::string const& path, proving_key const& key)
+{
+    // Sort the polynomials by label, so that equal keys give equal files.
+    std::vector<std::pair<std::string, barretenberg::polynomial const*>> polynomials;
+    for (auto const& [label, polynomial] : key.polynomial_store) {
+        polynomials.emplace_back(label, &polynomial);
+    }
+    std::sort(polynomials.begin(), polynomials.end(), [](auto const& a, auto const& b) { return a.first < b.first; });
+
+    // The metadata size depends on the offsets only through their fixed-size encoding, so compute it with dummy
+    // offsets first.
+    std::vector<polynomial_entry> entries;
+    for (auto const& [label, polynomial] : polynomials) {
+        entries.push_back({ label, polynomial->size(), 0 });
+    }
+    auto write_metadata = [&](std::vector<uint8_t>& buf) {
+        write_field(buf, key.composer_type);
+        write_field(buf, static_cast<uint32_t>(key.circuit_size));
+        write_field(buf, static_cast<uint32_t>(key.num_public_inputs));
+        write_field(buf, key.contains_recursive_proof);
+        write_field(buf, key.recursive_proof_public_input_indices);
+        write_field(buf, key.memory_read_records);
+        write_field(buf, key.memory_write_records);
+        write_field(buf, static_cast<uint32_t>(entries.size()));
+        for (auto const& entry : entries) {
+            write_field(buf, entry.label);
+            write_field(buf, entry.size);
+            write_field(buf, entry.offset);
+        }
+    };
+    std::vector<uint8_t> metadata;
+    write_metadata(metadata);
+
+    uint64_t offset = round_up_to_page(sizeof(proving_key_file_header) + metadata.size());
+    for (auto& entry : entries) {
+        entry.offset = offset;
+        offset = round_up_to_page(offset + get_polynomial_bytes(entry.size));
+    }
+    metadata.clear();
+    write_metadata(metadata);
+    const proving_key_file_header header{ PROVING_KEY_FILE_MAGIC, PROVING_KEY_FILE_VERSION, metadata.size(), offset };
+
+    const std::string temp_path = path + ".tmp" + std::to_string(getpid());
+    {
+        std::ofstream file(temp_path, std::ofstream::binary);
+        file.write((char const*)&header, sizeof(header));
+        file.write((char const*)metadata.data(), (std::streamsize)metadata.size());
+        const std::vector<char> zeros(PAGE_SIZE + sizeof(barretenberg::fr), 0);
+        size_t position = sizeof(header) + metadata.size();
+        for (size_t i = 0; i < entries.size(); ++i) {
+            file.write(zeros.data(), (std::streamsize)(entries[i].offset - position));
+            file.write((char const*)polynomials[i].second->data(),
+                       (std::streamsize)(entries[i].size * sizeof(barretenberg::fr)));
+            // The extra coefficient read by `shifted`.
+            file.write(zeros.data(), sizeof(barretenberg::fr));
+            position = entries[i].offset + get_polynomial_bytes(entries[i].size);
+        }
+        file.write(zeros.data(), (std::streamsize)(header.file_size - position));
+        if (!file) {
+            std::remove(temp_path.c_str());
+            throw_or_abort("Unable to write proving key to " + temp_path);
+        }
+    }
+    if (std::rename(temp_path.c_str(), path.c_str()) != 0) {
+        std::remove(temp_path.c_str());
+        throw_or_abort("Unable to write proving key to " + path + ": " + std::strerror(errno));
+    }
+}
+
+proving_key_data read_proving_key_file(std::string const& path)
+{
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw_or_abort("Unable to open proving key " + path + ": " + std::strerror(errno));
+    }
+    struct stat st;
+    proving_key_file_header header;
+    const bool valid_header = fstat(fd, &st) == 0 && pread(fd, &header, sizeof(header), 0) == sizeof(header) &&
+                              header.magic == PROVING_KEY_FILE_MAGIC && header.version == PROVING_KEY_FILE_VERSION &&
+                              header.file_size == static_cast<uint64_t>(st.st_size) &&
+                              header.metadata_size <= header.file_size - sizeof(header);
+    if (!valid_header) {
+        close(fd);
+        throw_or_abort("Invalid proving key file " + path);
+    }
+
+    // A private, writable mapping: the prover's writes are copied on write and never reach the file.
+    const size_t file_size = header.file_size;
+    void* data = mmap(nullptr, file_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    // The mapping stays valid after the descriptor is closed.
+    close(fd);
+    if (data == MAP_FAILED) {
+        throw_or_abort("Unable to map proving key " + path + ": " + std::strerror(errno));
+    }
+    std::shared_ptr<void> mapping(data, [file_size](void* p) { munmap(p, file_size); });
+
+    proving_key_data key;
+    auto const* metadata = static_cast<uint8_t const*>(data) + sizeof(header);
+    const size_t metadata_end = sizeof(header) + header.metadata_size;
+    metadata_reader reader(metadata, metadata + header.metadata_size, path);
+    reader.read(key.composer_type);
+    reader.read(key.circuit_size);
+    reader.read(key.num_public_inputs);
+    reader.read(key.contains_recursive_proof);
+    reader.read(key.recursive_proof_public_input_indices);
+    reader.read(key.memory_read_records);
+    reader.read(key.memory_write_records);
+    uint32_t num_polynomials = 0;
+    reader.read(num_polynomials);
+    for (size_t i = 0; i < num_polynomials; ++i) {
+        polynomial_entry entry;
+        reader.read(entry.label);
+        reader.read(entry.size);
+        reader.read(entry.offset);
+        if (entry.offset % PAGE_SIZE != 0 || entry.offset < metadata_end || entry.offset > file_size ||
+            entry.size >= (file_size - entry.offset) / sizeof(barretenberg::fr)) {
+            throw_or_abort("Invalid polynomial " + entry.label + " in proving key file " + path);
+        }
+        auto* coefficients = (barretenberg::fr*)(static_cast<uint8_t*>(data) + entry.offset);
+        key.polynomial_store.put(entry.label, barretenberg::polynomial(coefficients, entry.size, mapping));
+    }
+    if (!reader.at_end()) {
+        throw_or_abort("Invalid metadata in proving key file " + path);
+    }
+    return key;
+}
+
+} // namespace proof_system::plonk
+#endif
@@ -0,0 +1,41 @@
+#pragma once
+#ifndef __wasm__
+#include "proving_key.hpp"
+#include <string>
+
+namespace proof_system::plonk {
+
+/**
+ * @brief A single file holding a proving key, whose polynomials are served straight from a mapping of the file.
+ *
+ * @details `read(B&, proving_key_data&)` copies every polynomial out of the buffer it reads, and `read_mmap` needs a
+ * file per polynomial. This container holds the whole key:
+ *
+ *     [ header ][ metadata ][ padding ][ polynomial ][ padding ][ polynomial ] ...
+ *
+ * The metadata holds the proving_key_data fields and, for each polynomial in the key's store, its label, size and
+ * offset. Every polynomial starts at a page boundary and is stored as its size + 1 coefficients (the last is zero, as
+ * `Polynomial::shifted` expects), in Montgomery form and native byte order.
+ *
+ * Reading maps the file privately: pages are only read when a polynomial is first used, and a page is copied only if
+ * the prover writes to it, so the file is never modified. The mapping is released when the last of its polynomials is
+ * destroyed.
+ *
+ * The coefficients are stored as they sit in memory: PROVING_KEY_FILE_VERSION must be bumped if the field
+ * representation or this layout changes, so that older files are rejected.
+ */
+constexpr uint64_t PROVING_KEY_FILE_VERSION = 1;
+
+/**
+ * @brief Write `key` to `path`. Every polynomial in the key's store is written, so write the key before proving. The
+ * file is written next to `path` and then renamed over it.
+ */
+void write_proving_key_file(std::string const& path, proving_key const& key);
+
+/**
+ * @brief Map the proving key file at `path`. Throws if the file is missing, truncated or of another version.
+ */
+proving_key_data read_proving_key_file(std::string const& path);
+
+} // namespace proof_system::plonk
+#endif
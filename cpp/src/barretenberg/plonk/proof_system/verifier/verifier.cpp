@@ -36,7 +36,10 @@ VerifierBase<program_settings>& VerifierBase<program_settings>::operator=(Verifi
     return *this;
 }
 
-template <typename program_settings> bool VerifierBase<program_settings>::verify_proof(const plonk::proof& proof)
+template <typename program_settings>
+void VerifierBase<program_settings>::compute_pairing_terms(const plonk::proof& proof,
+                                                           const barretenberg::fr& batch_scalar,
+                                                           pairing_terms& terms)
 {
     // This function verifies a PLONK proof for given program settings.
     // A PLONK proof for standard PLONK is of the form:
@@ -48,6 +51,8 @@ template <typename program_settings> bool VerifierBase<program_settings>::verify
     // Proof π_SNARK must first be added to the transcript with the other program_settings.
 
     key->program_width = program_settings::program_width;
+    kate_g1_elements.clear();
+    kate_fr_elements.clear();
 
     // Add the proof data to the transcript, according to the manifest. Also initialise the transcript's hash type and
     // challenge bytes.
@@ -163,26 +168,15 @@ template <typename program_settings> bool VerifierBase<program_settings>::verify
     kate_g1_elements.insert({ "PI_Z", PI_Z });
     kate_fr_elements.insert({ "PI_Z", zeta });
 
-    std::vector<fr> scalars;
-    std::vector<g1::affine_element> elements;
-
-    for (const auto& [key, value] : kate_g1_elements) {
+    for (const auto& [label, value] : kate_g1_elements) {
         // TODO: perhaps we should throw if not on curve or if infinity?
         if (value.on_curve() && !value.is_point_at_infinity()) {
-            scalars.emplace_back(kate_fr_elements.at(key));
-            elements.emplace_back(value);
+            terms.add(0, value, kate_fr_elements.at(label) * batch_scalar);
         }
     }
 
-    size_t num_elements = elements.size();
-    elements.resize(num_elements * 2);
-    barretenberg::scalar_multiplication::generate_pippenger_point_table(&elements[0], &elements[0], num_elements);
-    scalar_multiplication::pippenger_runtime_state state(num_elements);
-
-    g1::element P[2];
-
-    P[0] = barretenberg::scalar_multiplication::pippenger(&scalars[0], &elements[0], num_elements, state);
-    P[1] = -(g1::element(PI_Z_OMEGA) * separator_challenge + PI_Z);
+    terms.add(1, PI_Z_OMEGA, -(separator_challenge * batch_scalar));
+    terms.add(1, PI_Z, -batch_scalar);
 
     if (key->contains_recursive_proof) {
         ASSERT(key->recursive_proof_public_input_indices.size() == 16);
@@ -219,8 +213,22 @@ template <typename program_settings> bool VerifierBase<program_settings>::verify
                                                       key->recursive_proof_public_input_indices[14],
                                                       key->recursive_proof_public_input_indices[15]);
 
-        P[0] += g1::element(x0, y0, 1) * recursion_separator_challenge;
-        P[1] += g1::element(x1, y1, 1) * recursion_separator_challenge;
+        terms.add(0, { x0, y0 }, recursion_separator_challenge * batch_scalar);
+        terms.add(1, { x1, y1 }, recursion_separator_challenge * batch_scalar);
+    }
+}
+
+template <typename program_settings> bool VerifierBase<program_settings>::check_pairing(pairing_terms& terms) const
+{
+    g1::element P[2];
+    for (size_t i = 0; i < 2; ++i) {
+        auto& scalars = terms.scalars[i];
+        auto& elements = terms.elements[i];
+        const size_t num_elements = elements.size();
+        elements.resize(num_elements * 2);
+        barretenberg::scalar_multiplication::generate_pippenger_point_table(&elements[0], &elements[0], num_elements);
+        scalar_multiplication::pippenger_runtime_state state(num_elements);
+        P[i] = barretenberg::scalar_multiplication::pippenger(&scalars[0], &elements[0], num_elements, state);
     }
 
     g1::element::batch_normalize(P, 2);
@@ -237,6 +245,45 @@ template <typename program_settings> bool VerifierBase<program_settings>::verify
     return (result == barretenberg::fq12::one());
 }
 
+template <typename program_settings> bool VerifierBase<program_settings>::verify_proof(const plonk::proof& proof)
+{
+    pairing_terms terms;
+    compute_pairing_terms(proof, fr::one(), terms);
+    return check_pairing(terms);
+}
+
+template <typename program_settings>
+bool VerifierBase<program_settings>::verify_proof_batch(std::span<const plonk::proof> proofs)
+{
+    if (proofs.empty()) {
+        return true;
+    }
+    pairing_terms terms;
+    for (const auto& proof : proofs) {
+        compute_pairing_terms(proof, fr::random_element(), terms);
+    }
+    return check_pairing(terms);
+}
+
+template <typename program_settings>
+std::vector<bool> VerifierBase<program_settings>::verify_proofs(std::span<const plonk::proof> proofs)
+{
+    // Each proof passes if e(P_0, [1]_2).e(P_1, [x]_2) == 1. Scaling each proof's P_0 and P_1 by a random r_i and
+    // summing gives a single check that passes with negligible probability unless every proof passes. The terms of all
+    // proofs go into one multi-scalar multiplication per pairing input, in which the verification key's commitments
+    // (and [1]_1) appear once, however many proofs there are.
+    if (verify_proof_batch(proofs)) {
+        return std::vector<bool>(proofs.size(), true);
+    }
+
+    // At least one proof is bad: check them one by one to find out which.
+    std::vector<bool> results;
+    for (const auto& proof : proofs) {
+        results.push_back(verify_proof(proof));
+    }
+    return results;
+}
+
 template class VerifierBase<standard_verifier_settings>;
 template class VerifierBase<turbo_verifier_settings>;
 template class VerifierBase<ultra_verifier_settings>;
@@ -4,6 +4,8 @@
 #include "../widgets/random_widgets/random_widget.hpp"
 #include "barretenberg/transcript/manifest.hpp"
 #include "barretenberg/plonk/proof_system/commitment_scheme/commitment_scheme.hpp"
+#include <span>
+#include <vector>
 
 namespace proof_system::plonk {
 template <typename program_settings> class VerifierBase {
@@ -20,12 +22,51 @@ template <typename program_settings> class VerifierBase {
     bool validate_scalars();
 
     bool verify_proof(const plonk::proof& proof);
+
+    /**
+     * Verify `proofs` against this verifier's key with a single pairing check, which combines the proofs' final
+     * checks with random weights. If that check fails, the proofs are verified one by one. Returns whether each proof
+     * is valid. As with `verify_proof`, throws if a proof's opening commitments are not valid points.
+     */
+    std::vector<bool> verify_proofs(std::span<const plonk::proof> proofs);
+
+    /**
+     * Whether every one of `proofs` is valid, from the single combined pairing check of `verify_proofs`.
+     */
+    bool verify_proof_batch(std::span<const plonk::proof> proofs);
+
     transcript::Manifest manifest;
 
     std::shared_ptr<verification_key> key;
     std::map<std::string, barretenberg::g1::affine_element> kate_g1_elements;
     std::map<std::string, barretenberg::fr> kate_fr_elements;
     std::unique_ptr<CommitmentScheme> commitment_scheme;
+
+  private:
+    // The final check of a proof is e(P_0, [1]_2).e(P_1, [x]_2) == 1. P_0 and P_1 are kept as the terms of multi-scalar
+    // multiplications, so that the checks of several proofs can share them.
+    struct pairing_terms {
+        std::vector<barretenberg::fr> scalars[2];
+        std::vector<barretenberg::g1::affine_element> elements[2];
+        // The term of each x-coordinate. Pippenger's affine additions cannot add a point to itself or to its negation,
+        // so a point that is already a term, or whose negation is, is merged into that term rather than added again.
+        std::map<barretenberg::fq, size_t> x_indices[2];
+
+        void add(const size_t i, const barretenberg::g1::affine_element& element, const barretenberg::fr& scalar)
+        {
+            const auto [it, inserted] = x_indices[i].try_emplace(element.x, elements[i].size());
+            if (!inserted) {
+                scalars[i][it->second] += (elements[i][it->second].y == element.y) ? scalar : -scalar;
+                return;
+            }
+            scalars[i].push_back(scalar);
+            elements[i].push_back(element);
+        }
+    };
+
+    // Append the terms of `proof`'s final check, scaled by `batch_scalar`, to `terms`.
+    void compute_pairing_terms(const plonk::proof& proof, const barretenberg::fr& batch_scalar, pairing_terms& terms);
+    bool check_pairing(pairing_terms& terms) const;
 };
 
 extern template class VerifierBase<standard_verifier_settings>;
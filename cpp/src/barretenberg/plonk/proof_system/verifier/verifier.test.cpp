@@ -291,3 +291,53 @@ TEST(verifier, verify_damaged_proof)
     EXPECT_ANY_THROW(verifier.verify_proof(proof));
 }
 #endif
+
+TEST(verifier, verify_proofs)
+{
+    plonk::StandardComposer composer = plonk::StandardComposer();
+    const uint32_t a_idx = composer.add_public_variable(barretenberg::fr(5));
+    const uint32_t b_idx = composer.add_variable(barretenberg::fr(7));
+    const uint32_t c_idx = composer.add_variable(barretenberg::fr(35));
+    composer.create_mul_gate(
+        { a_idx, b_idx, c_idx, barretenberg::fr::one(), barretenberg::fr::neg_one(), barretenberg::fr::zero() });
+
+    std::vector<plonk::proof> proofs;
+    for (size_t i = 0; i < 4; ++i) {
+        auto prover = composer.create_prover();
+        proofs.push_back(prover.construct_proof());
+    }
+    auto verifier = composer.create_verifier();
+
+    EXPECT_EQ(verifier.verify_proofs(proofs), std::vector<bool>(4, true));
+    EXPECT_TRUE(verifier.verify_proofs({}).empty());
+
+    // Change the public input of one proof: the batch check fails, and the bad proof is found.
+    proofs[2].proof_data[31] ^= 1;
+    EXPECT_EQ(verifier.verify_proofs(proofs), (std::vector<bool>{ true, true, false, true }));
+    EXPECT_FALSE(verifier.verify_proof(proofs[2]));
+    EXPECT_TRUE(verifier.verify_proof(proofs[3]));
+}
+
+TEST(verifier, verify_proof_batch_with_repeated_proofs)
+{
+    plonk::StandardComposer composer = plonk::StandardComposer();
+    const uint32_t a_idx = composer.add_public_variable(barretenberg::fr(5));
+    const uint32_t b_idx = composer.add_variable(barretenberg::fr(7));
+    const uint32_t c_idx = composer.add_variable(barretenberg::fr(35));
+    composer.create_mul_gate(
+        { a_idx, b_idx, c_idx, barretenberg::fr::one(), barretenberg::fr::neg_one(), barretenberg::fr::zero() });
+
+    auto prover = composer.create_prover();
+    const plonk::proof proof = prover.construct_proof();
+    auto verifier = composer.create_verifier();
+
+    // The copies share every commitment, so their terms are merged rather than handed to pippenger twice; the combined
+    // check passes by itself, without verifying the proofs one by one.
+    const std::vector<plonk::proof> proofs(3, proof);
+    EXPECT_TRUE(verifier.verify_proof_batch(std::span(proofs.begin(), 2)));
+    EXPECT_TRUE(verifier.verify_proof_batch(proofs));
+
+    plonk::proof bad_proof = proof;
+    bad_proof.proof_data[31] ^= 1;
+    EXPECT_FALSE(verifier.verify_proof_batch(std::vector<plonk::proof>{ proof, bad_proof, proof }));
+}
@@ -38,8 +38,24 @@ class ProverPermutationWidget : public ProverRandomWidget {
                                    const size_t round_number,
                                    work_queue& queue) override;
 
-    barretenberg::fr compute_quotient_contribution(const barretenberg::fr& alpha_base,
+    barretenberg::fr prepare_quotient_contribution(const barretenberg::fr& alpha_base,
                                                    const transcript::StandardTranscript& transcript) override;
+
+    void accumulate_quotient_contribution(const size_t start, const size_t end) override;
+
+  private:
+    // Set by prepare_quotient_contribution.
+    struct QuotientInputs {
+        barretenberg::fr alpha_base;
+        barretenberg::fr beta;
+        barretenberg::fr gamma;
+        barretenberg::fr public_input_delta;
+        const barretenberg::fr* z_perm_fft;
+        const barretenberg::fr* l_start;
+        std::array<const barretenberg::fr*, program_width> wire_ffts;
+        std::array<const barretenberg::fr*, program_width> sigma_ffts;
+        std::array<const barretenberg::fr*, program_width> id_ffts;
+    } quotient_inputs;
 };
 
 } // namespace proof_system::plonk
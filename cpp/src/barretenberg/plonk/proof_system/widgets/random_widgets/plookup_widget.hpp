@@ -42,8 +42,28 @@ class ProverPlookupWidget : public ProverRandomWidget {
                                           const size_t round_number,
                                           work_queue& queue) override;
 
-    inline barretenberg::fr compute_quotient_contribution(const barretenberg::fr& alpha_base,
+    inline barretenberg::fr prepare_quotient_contribution(const barretenberg::fr& alpha_base,
                                                           const transcript::StandardTranscript& transcript) override;
+
+    inline void accumulate_quotient_contribution(const size_t start, const size_t end) override;
+
+  private:
+    // Set by prepare_quotient_contribution.
+    struct QuotientInputs {
+        barretenberg::fr alpha_base;
+        barretenberg::fr alpha;
+        barretenberg::fr beta;
+        barretenberg::fr gamma;
+        barretenberg::fr eta;
+        const barretenberg::fr* z_lookup_fft;
+        std::array<const barretenberg::fr*, 3> wire_ffts;
+        const barretenberg::fr* s_fft;
+        std::array<const barretenberg::fr*, 4> table_ffts;
+        std::array<const barretenberg::fr*, 3> column_step_sizes;
+        const barretenberg::fr* lookup_fft;
+        const barretenberg::fr* lookup_index_fft;
+        const barretenberg::fr* l_1;
+    } quotient_inputs;
 };
 
 } // namespace proof_system::plonk
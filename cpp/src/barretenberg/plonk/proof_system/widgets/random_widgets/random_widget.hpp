@@ -47,9 +47,20 @@ class ProverRandomWidget {
 
     virtual void compute_round_commitments(transcript::StandardTranscript&, const size_t, work_queue&){};
 
-    virtual barretenberg::fr compute_quotient_contribution(const barretenberg::fr& alpha_base,
+    /**
+     * @brief Read the challenges and polynomials the widget needs to compute its quotient contribution.
+     *
+     * @return The power of α following the widget's relations, for the next widget.
+     */
+    virtual barretenberg::fr prepare_quotient_contribution(const barretenberg::fr& alpha_base,
                                                            const transcript::StandardTranscript& transcript) = 0;
 
+    /**
+     * @brief Add the widget's contribution to the quotient at points [start, end) of the large domain. Must follow
+     * prepare_quotient_contribution; disjoint ranges may be computed concurrently.
+     */
+    virtual void accumulate_quotient_contribution(const size_t start, const size_t end) = 0;
+
     proving_key* key;
 };
 
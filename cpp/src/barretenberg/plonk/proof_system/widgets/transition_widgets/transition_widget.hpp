@@ -3,7 +3,6 @@
 #include <array>
 #include <vector>
 #include <set>
-#include <unordered_map>
 
 #include "barretenberg/polynomials/iterate_over_domain.hpp"
 #include "../../types/prover_settings.hpp"
@@ -42,7 +41,8 @@ template <class Field, size_t num_widget_relations> struct challenge_array {
 template <class Field> using poly_array = std::array<std::pair<Field, Field>, PolynomialIndex::MAX_NUM_POLYNOMIALS>;
 
 template <class Field> struct poly_ptr_map {
-    std::unordered_map<PolynomialIndex, std::span<Field>> coefficients;
+    // Indexed by PolynomialIndex; only the polynomials a widget requires are set.
+    std::array<std::span<Field>, PolynomialIndex::MAX_NUM_POLYNOMIALS> coefficients;
     size_t block_mask;
     size_t index_shift;
 };
@@ -270,7 +270,18 @@ template <class Field> class TransitionWidgetBase {
     };
     virtual ~TransitionWidgetBase() {}
 
-    virtual Field compute_quotient_contribution(const Field&, const transcript::StandardTranscript&) = 0;
+    /**
+     * @brief Read the challenges and polynomials the widget needs to compute its quotient contribution.
+     *
+     * @return The power of α following the widget's relations, for the next widget.
+     */
+    virtual Field prepare_quotient_contribution(const Field&, const transcript::StandardTranscript&) = 0;
+
+    /**
+     * @brief Add the widget's contribution to the quotient at points [start, end) of the large domain. Must follow
+     * prepare_quotient_contribution; disjoint ranges may be computed concurrently.
+     */
+    virtual void accumulate_quotient_contribution(const size_t start, const size_t end) = 0;
 
   public:
     proving_key* key;
@@ -310,7 +321,7 @@ class TransitionWidget : public TransitionWidgetBase<Field> {
         return *this;
     };
 
-    Field compute_quotient_contribution(const Field& alpha_base,
+    Field prepare_quotient_contribution(const Field& alpha_base,
                                         const transcript::StandardTranscript& transcript) override
     {
         auto* key = TransitionWidgetBase<Field>::key;
@@ -319,25 +330,34 @@ class TransitionWidget : public TransitionWidgetBase<Field> {
         auto& required_polynomial_ids = FFTKernel::get_required_polynomial_ids();
 
         // Construct the map of pointers to the required polynomials
-        poly_ptr_map polynomials = FFTGetter::get_polynomials(key, required_polynomial_ids);
+        polynomials = FFTGetter::get_polynomials(key, required_polynomial_ids);
 
-        challenge_array challenges =
-            FFTGetter::get_challenges(transcript, alpha_base, FFTKernel::quotient_required_challenges);
+        challenges = FFTGetter::get_challenges(transcript, alpha_base, FFTKernel::quotient_required_challenges);
 
-        ITERATE_OVER_DOMAIN_START(key->large_domain);
-        coefficient_array linear_terms;
-        FFTKernel::compute_linear_terms(polynomials, challenges, linear_terms, i);
-        Field sum_of_linear_terms = FFTKernel::sum_linear_terms(polynomials, challenges, linear_terms, i);
+        return FFTGetter::update_alpha(challenges, FFTKernel::num_independent_relations);
+    }
+
+    void accumulate_quotient_contribution(const size_t start, const size_t end) override
+    {
+        auto* key = TransitionWidgetBase<Field>::key;
 
-        // populate split quotient components
-        Field& quotient_term =
-            key->quotient_polynomial_parts[i >> key->small_domain.log2_size][i & (key->circuit_size - 1)];
-        quotient_term += sum_of_linear_terms;
-        FFTKernel::compute_non_linear_terms(polynomials, challenges, quotient_term, i);
-        ITERATE_OVER_DOMAIN_END;
+        for (size_t i = start; i < end; ++i) {
+            coefficient_array linear_terms;
+            FFTKernel::compute_linear_terms(polynomials, challenges, linear_terms, i);
+            Field sum_of_linear_terms = FFTKernel::sum_linear_terms(polynomials, challenges, linear_terms, i);
 
-        return FFTGetter::update_alpha(challenges, FFTKernel::num_independent_relations);
+            // populate split quotient components
+            Field& quotient_term =
+                key->quotient_polynomial_parts[i >> key->small_domain.log2_size][i & (key->circuit_size - 1)];
+            quotient_term += sum_of_linear_terms;
+            FFTKernel::compute_non_linear_terms(polynomials, challenges, quotient_term, i);
+        }
     }
+
+  private:
+    // Set by prepare_quotient_contribution.
+    poly_ptr_map polynomials;
+    challenge_array challenges;
 };
 
 template <class Field, class Transcript, class Settings, template <typename, typename, typename> typename KernelBase>
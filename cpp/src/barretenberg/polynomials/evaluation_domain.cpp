@@ -56,7 +56,9 @@ void compute_lookup_table_single(const Fr& input_root,
 } // namespace
 
 template <typename Fr>
-EvaluationDomain<Fr>::EvaluationDomain(const size_t domain_size, const size_t target_generator_size)
+EvaluationDomain<Fr>::EvaluationDomain(const size_t domain_size,
+                                       const size_t target_generator_size,
+                                       const FFTAlgorithm algorithm)
     : size(domain_size)
     , num_threads(compute_num_threads(domain_size))
     , thread_size(domain_size / num_threads)
@@ -71,6 +73,7 @@ EvaluationDomain<Fr>::EvaluationDomain(const size_t domain_size, const size_t ta
     , generator(Fr::coset_generator(0))
     , generator_inverse(Fr::coset_generator(0).invert())
     , four_inverse(Fr(4).invert())
+    , fft_algorithm(algorithm)
     , roots(nullptr)
 {
     ASSERT((1UL << log2_size) == size || (size == 0));
@@ -94,6 +97,7 @@ EvaluationDomain<Fr>::EvaluationDomain(const EvaluationDomain& other)
     , generator(other.generator)
     , generator_inverse(other.generator_inverse)
     , four_inverse(other.four_inverse)
+    , fft_algorithm(other.fft_algorithm)
 {
     ASSERT((1UL << log2_size) == size);
     ASSERT((1UL << log2_thread_size) == thread_size);
@@ -131,6 +135,7 @@ EvaluationDomain<Fr>::EvaluationDomain(EvaluationDomain&& other)
     , generator(other.generator)
     , generator_inverse(other.generator_inverse)
     , four_inverse(other.four_inverse)
+    , fft_algorithm(other.fft_algorithm)
 {
     roots = other.roots;
     round_roots = std::move(other.round_roots);
@@ -154,6 +159,7 @@ template <typename Fr> EvaluationDomain<Fr>& EvaluationDomain<Fr>::operator=(Eva
     Fr::__copy(other.generator, generator);
     Fr::__copy(other.generator_inverse, generator_inverse);
     Fr::__copy(other.four_inverse, four_inverse);
+    fft_algorithm = other.fft_algorithm;
     if (roots != nullptr) {
         aligned_free(roots);
     }
@@ -5,6 +5,18 @@
 
 namespace barretenberg {
 
+/**
+ * The algorithm used by the `polynomial_arithmetic` FFTs over a domain.
+ *
+ * RADIX_2 runs log(n) butterfly rounds, each of which streams over the whole domain. Once the domain no longer fits in
+ * cache every round is bound by memory bandwidth.
+ *
+ * FOUR_STEP views the domain as a matrix with R = 2^{floor(log(n)/2)} rows and C = n / R columns. It runs R-point
+ * FFTs down the columns, multiplies by twiddle factors, runs C-point FFTs along the rows and transposes the result.
+ * Every sub-FFT fits in cache, so the full domain is only streamed a constant number of times.
+ **/
+enum class FFTAlgorithm { RADIX_2, FOUR_STEP };
+
 template <typename Fr> class EvaluationDomain {
   public:
     EvaluationDomain()
@@ -22,9 +34,12 @@ template <typename Fr> class EvaluationDomain {
         , generator(fr::zero())
         , generator_inverse(fr::zero())
         , four_inverse(fr::zero())
+        , fft_algorithm(FFTAlgorithm::RADIX_2)
         , roots(nullptr){};
 
-    EvaluationDomain(const size_t domain_size, const size_t target_generator_size = 0);
+    EvaluationDomain(const size_t domain_size,
+                     const size_t target_generator_size = 0,
+                     const FFTAlgorithm algorithm = FFTAlgorithm::RADIX_2);
     EvaluationDomain(const EvaluationDomain& other);
     EvaluationDomain(EvaluationDomain&& other);
 
@@ -40,7 +55,10 @@ template <typename Fr> class EvaluationDomain {
     const std::vector<Fr*>& get_inverse_round_roots() const { return inverse_round_roots; }
 
     size_t size;        // n, always a power of 2
-    size_t num_threads; // num_threads * thread_size = size
+    // num_threads * thread_size = size. A power-of-two partition of the domain, used by code that derives per-thread
+    // offsets from `thread_size` (e.g. `ITERATE_OVER_DOMAIN_START`). The FFTs themselves split their butterflies over
+    // all available threads, see `max_threads::compute_num_threads_unrounded`.
+    size_t num_threads;
     size_t thread_size;
     size_t log2_size;
     size_t log2_thread_size;
@@ -55,6 +73,8 @@ template <typename Fr> class EvaluationDomain {
     Fr generator_inverse;
     Fr four_inverse;
 
+    FFTAlgorithm fft_algorithm;
+
   private:
     std::vector<Fr*> round_roots; // An entry for each of the log(n) rounds: each entry is a pointer to
                                   // the subset of the roots of unity required for that fft round.
@@ -66,6 +66,7 @@ Polynomial<Fr>::Polynomial(Polynomial<Fr>&& other) noexcept
     : coefficients_(std::exchange(other.coefficients_, nullptr))
     , size_(std::exchange(other.size_, 0))
     , mapped_(std::exchange(other.mapped_, false))
+    , backing_memory_(std::move(other.backing_memory_))
 {}
 
 template <typename Fr>
@@ -75,6 +76,14 @@ Polynomial<Fr>::Polynomial(Fr* buf, const size_t size_)
     , mapped_(false)
 {}
 
+template <typename Fr>
+Polynomial<Fr>::Polynomial(Fr* buf, const size_t size_, std::shared_ptr<void> backing_memory)
+    : coefficients_(buf)
+    , size_(size_)
+    , mapped_(false)
+    , backing_memory_(std::move(backing_memory))
+{}
+
 template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator=(const Polynomial<Fr>& other)
 {
     if (is_empty()) {
@@ -103,6 +112,7 @@ template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator=(Polynomial&& ot
     coefficients_ = std::exchange(other.coefficients_, nullptr);
     size_ = std::exchange(other.size_, 0);
     mapped_ = std::exchange(other.mapped_, false);
+    backing_memory_ = std::move(other.backing_memory_);
 
     return *this;
 }
@@ -148,7 +158,9 @@ template <typename Fr> void Polynomial<Fr>::zero_memory_beyond(const size_t star
 
 template <typename Fr> void Polynomial<Fr>::free()
 {
-    if (coefficients_ != nullptr) {
+    if (backing_memory_) {
+        backing_memory_.reset();
+    } else if (coefficients_ != nullptr) {
 #ifndef __wasm__
         if (mapped_) {
             munmap(coefficients_, size_ * sizeof(Fr));
@@ -6,6 +6,7 @@
 #include "barretenberg/common/timer.hpp"
 #include <fstream>
 #include <concepts>
+#include <memory>
 #include <span>
 #include "polynomial_arithmetic.hpp"
 
@@ -23,6 +24,11 @@ template <typename Fr> class Polynomial {
     // Takes ownership of given buffer.
     Polynomial(Fr* buf, const size_t initial_size);
 
+    // Views `buf`, which must hold capacity() coefficients and stays valid for as long as `backing_memory` is alive
+    // (e.g. a region of a mapped file shared by several polynomials). The polynomial is writable, and never frees
+    // `buf` itself.
+    Polynomial(Fr* buf, const size_t initial_size, std::shared_ptr<void> backing_memory);
+
     // Allow polynomials to be entirely reset/dormant
     Polynomial() = default;
 
@@ -225,6 +231,8 @@ template <typename Fr> class Polynomial {
     // polynomial.
     size_t size_ = 0;
     bool mapped_ = false;
+    // If set, owns the memory the coefficients live in, instead of the polynomial itself.
+    std::shared_ptr<void> backing_memory_;
 };
 
 template <typename Fr> inline std::ostream& operator<<(std::ostream& os, Polynomial<Fr> const& p)
@@ -2,6 +2,7 @@
 #include "iterate_over_domain.hpp"
 #include "barretenberg/common/assert.hpp"
 #include "barretenberg/common/mem.hpp"
+#include <algorithm>
 #include <math.h>
 #include <memory.h>
 #include "barretenberg/numeric/bitop/get_msb.hpp"
@@ -11,7 +12,12 @@ namespace barretenberg::polynomial_arithmetic {
 
 namespace {
 
-template <typename Fr> Fr* get_scratch_space(const size_t num_elements)
+/**
+ * Working memory that is kept between calls. Each slot is a separate buffer, so that a function holding one slot can
+ * call another that uses a different slot, e.g. `coset_fft` writes its FFTs into slot 0, and the four-step FFT uses
+ * slot 1 for its transposed matrix.
+ **/
+template <typename Fr, size_t slot = 0> Fr* get_scratch_space(const size_t num_elements)
 {
     static Fr* working_memory = nullptr;
     static size_t current_size = 0;
@@ -25,6 +31,21 @@ template <typename Fr> Fr* get_scratch_space(const size_t num_elements)
     return working_memory;
 }
 
+/**
+ * The butterflies of an FFT round are independent, so the FFT splits them over every available thread (see
+ * `max_threads::get_thread_range`) rather than using the power-of-two partition of the evaluation domain.
+ * Small domains are run on a single thread.
+ **/
+size_t compute_fft_num_threads(const size_t domain_size)
+{
+    constexpr size_t MIN_GROUP_PER_THREAD = 4;
+    const size_t num_threads = max_threads::compute_num_threads_unrounded();
+    if (domain_size <= (num_threads * MIN_GROUP_PER_THREAD)) {
+        return 1;
+    }
+    return num_threads;
+}
+
 } // namespace
 
 inline uint32_t reverse_bits(uint32_t x, uint32_t bit_length)
@@ -118,14 +139,14 @@ void scale_by_generator(Fr* coeffs,
                         const Fr& generator_shift,
                         const size_t generator_size)
 {
+    const size_t num_threads = compute_fft_num_threads(domain.size);
 #ifndef NO_MULTITHREADING
 #pragma omp parallel for
 #endif
-    for (size_t j = 0; j < domain.num_threads; ++j) {
-        Fr thread_shift = generator_shift.pow(static_cast<uint64_t>(j * (generator_size / domain.num_threads)));
+    for (size_t j = 0; j < num_threads; ++j) {
+        const auto [offset, end] = max_threads::get_thread_range(generator_size, num_threads, j);
+        Fr thread_shift = generator_shift.pow(static_cast<uint64_t>(offset));
         Fr work_generator = generator_start * thread_shift;
-        const size_t offset = j * (generator_size / domain.num_threads);
-        const size_t end = offset + (generator_size / domain.num_threads);
         for (size_t i = offset; i < end; ++i) {
             target[i] = coeffs[i] * work_generator;
             work_generator *= generator_shift;
@@ -164,12 +185,222 @@ void compute_multiplicative_subgroup(const size_t log2_subgroup_size,
     }
 }
 
+namespace {
+// Number of columns (rows) that the four-step FFT gathers (scatters) together. Field elements are 32 bytes, so a block
+// covers two full cache lines of every row it touches.
+constexpr size_t FOUR_STEP_BLOCK_SIZE = 4;
+
+// Number of polynomials that a batched four-step FFT transforms together. Each needs a domain-sized matrix in the
+// four-step scratch space, which is kept for the life of the process, so larger batches run in groups of this size.
+constexpr size_t FOUR_STEP_MAX_BATCH_SIZE = 4;
+
+// Number of butterflies whose twiddle products are computed by one call to `Fr::mul_batch`
+constexpr size_t BUTTERFLY_BATCH_SIZE = 32;
+
+/**
+ * Butterflies [start, end) of the FFT round with half-size `m`, read from `src` and written to `dest` (which may be
+ * equal), indexed as in `fft_inner_parallel`.
+ *
+ * Butterflies of the same block use consecutive roots and consecutive odd inputs, so the twiddle products of a run of
+ * them are computed with one `Fr::mul_batch` call. Rounds whose blocks are too short for a batch use `operator*`.
+ **/
+template <typename Fr>
+void fft_round_butterflies(
+    const Fr* src, Fr* dest, const Fr* round_roots, const size_t m, const size_t start, const size_t end)
+{
+    const size_t block_mask = m - 1;
+    const size_t index_mask = ~block_mask;
+    if (m < 8) {
+        Fr temp;
+        for (size_t i = start; i < end; ++i) {
+            const size_t k1 = (i & index_mask) << 1;
+            const size_t j1 = i & block_mask;
+            temp = round_roots[j1] * src[k1 + j1 + m];
+            dest[k1 + j1 + m] = src[k1 + j1] - temp;
+            dest[k1 + j1] = src[k1 + j1] + temp;
+        }
+        return;
+    }
+    std::array<Fr, BUTTERFLY_BATCH_SIZE> products;
+    for (size_t i = start; i < end;) {
+        const size_t k1 = (i & index_mask) << 1;
+        const size_t j1 = i & block_mask;
+        const size_t num_butterflies = std::min({ BUTTERFLY_BATCH_SIZE, m - j1, end - i });
+        const Fr* even = &src[k1 + j1];
+        Fr::mul_batch(
+            { &round_roots[j1], num_butterflies }, { even + m, num_butterflies }, { &products[0], num_butterflies });
+        Fr* even_dest = &dest[k1 + j1];
+        for (size_t l = 0; l < num_butterflies; ++l) {
+            even_dest[l + m] = even[l] - products[l];
+            even_dest[l] = even[l] + products[l];
+        }
+        i += num_butterflies;
+    }
+}
+
+/**
+ * Radix-2 butterflies over `size` contiguous elements, which must already be in bit-reversed order.
+ * The roots of round `m` are the (2m)'th roots of unity, which do not depend on the size of the FFT, so a sub-FFT can
+ * use the root table of any larger domain.
+ **/
+template <typename Fr> void fft_butterflies_serial(Fr* data, const size_t size, const std::vector<Fr*>& root_table)
+{
+    Fr temp;
+    for (size_t k = 0; k < size; k += 2) {
+        Fr::__copy(data[k + 1], temp);
+        data[k + 1] = data[k] - temp;
+        data[k] += temp;
+    }
+    for (size_t m = 2; m < size; m <<= 1) {
+        const Fr* round_roots = root_table[static_cast<size_t>(numeric::get_msb(m)) - 1];
+        fft_round_butterflies(data, data, round_roots, m, 0, size >> 1);
+    }
+}
+
+/**
+ * Four-step (Bailey) FFT of one or more polynomials, see `FFTAlgorithm`.
+ *
+ * Write n = R.C, an input index as j = C.j1 + j2 and an output index as k = k1 + R.k2. Then
+ *
+ *   X[k1 + R.k2] = \sum_{j2} \omega_C^{j2.k2} . \omega^{j2.k1} . \sum_{j1} \omega_R^{j1.k1} . x[C.j1 + j2]
+ *
+ * 1. the inner sum is an R-point FFT down column j2 of the row-major R x C matrix `coeffs`
+ * 2. which is multiplied by the twiddle factor \omega^{j2.k1}
+ * 3. the outer sum is a C-point FFT along row k1
+ * 4. and the output X[k1 + R.k2] is the transpose of the result
+ *
+ * Steps 1 and 2 gather blocks of columns into a per-thread buffer and write them back into `scratch_space`. Steps 3
+ * and 4 transform blocks of rows of `scratch_space` in place and scatter them into `target`. Each pass streams the
+ * domain once, instead of once per butterfly round.
+ *
+ * Each block is transformed for every polynomial in turn, so the twiddle factors of a block of columns are computed
+ * once and shared by all the polynomials, and the sub-FFT roots stay in L1. Each polynomial has its own R x C matrix in
+ * `scratch_space`, so callers bound the number of polynomials (see `fft_inner_batch`).
+ *
+ * `coeffs[p]` may be equal to `target[p]`: it is only read before the barrier between the two passes.
+ **/
+template <typename Fr>
+void fft_inner_four_step(const std::vector<const Fr*>& coeffs,
+                         const std::vector<Fr*>& target,
+                         const EvaluationDomain<Fr>& domain,
+                         const Fr& root,
+                         const std::vector<Fr*>& root_table)
+{
+    ASSERT(domain.log2_size >= 2);
+    ASSERT(coeffs.size() == target.size());
+    ASSERT(coeffs.size() <= FOUR_STEP_MAX_BATCH_SIZE);
+    const size_t num_polys = coeffs.size();
+    const size_t log2_num_rows = domain.log2_size >> 1;
+    const size_t num_rows = 1UL << log2_num_rows;
+    const size_t num_columns = domain.size >> log2_num_rows;
+    const size_t log2_num_columns = domain.log2_size - log2_num_rows;
+    const size_t column_block = std::min(FOUR_STEP_BLOCK_SIZE, num_columns);
+    const size_t row_block = std::min(FOUR_STEP_BLOCK_SIZE, num_rows);
+    const size_t num_threads = compute_fft_num_threads(domain.size);
+
+    // Not slot 0, which callers may pass as `coeffs` or `target`.
+    Fr* scratch_space = get_scratch_space<Fr, 1>(domain.size * num_polys);
+
+#ifndef NO_MULTITHREADING
+#pragma omp parallel
+#endif
+    {
+#ifndef NO_MULTITHREADING
+#pragma omp for
+#endif
+        for (size_t j = 0; j < num_threads; ++j) {
+            const auto [start, end] = max_threads::get_thread_range(num_columns / column_block, num_threads, j);
+            if (start == end) {
+                continue;
+            }
+            Fr* columns = static_cast<Fr*>(aligned_alloc(64, sizeof(Fr) * column_block * num_rows));
+            Fr* twiddles = static_cast<Fr*>(aligned_alloc(64, sizeof(Fr) * column_block * num_rows));
+            // \omega^{j2} for the current column j2
+            Fr column_root = root.pow(static_cast<uint64_t>(start * column_block));
+            for (size_t block = start; block < end; ++block) {
+                const size_t column_start = block * column_block;
+                for (size_t b = 0; b < column_block; ++b) {
+                    Fr* column_twiddles = &twiddles[b * num_rows];
+                    column_twiddles[0] = Fr::one();
+                    for (size_t k1 = 1; k1 < num_rows; ++k1) {
+                        column_twiddles[k1] = column_twiddles[k1 - 1] * column_root;
+                    }
+                    column_root *= root;
+                }
+                for (size_t p = 0; p < num_polys; ++p) {
+                    // gather the columns, in bit-reversed order
+                    for (size_t j1 = 0; j1 < num_rows; ++j1) {
+                        const size_t row =
+                            reverse_bits(static_cast<uint32_t>(j1), static_cast<uint32_t>(log2_num_rows));
+                        const Fr* src = &coeffs[p][j1 * num_columns + column_start];
+                        for (size_t b = 0; b < column_block; ++b) {
+                            Fr::__copy(src[b], columns[b * num_rows + row]);
+                        }
+                    }
+                    for (size_t b = 0; b < column_block; ++b) {
+                        Fr* column = &columns[b * num_rows];
+                        fft_butterflies_serial(column, num_rows, root_table);
+                        for (size_t k1 = 1; k1 < num_rows; ++k1) {
+                            column[k1] *= twiddles[b * num_rows + k1];
+                        }
+                    }
+                    Fr* matrix = &scratch_space[p * domain.size];
+                    for (size_t k1 = 0; k1 < num_rows; ++k1) {
+                        Fr* dest = &matrix[k1 * num_columns + column_start];
+                        for (size_t b = 0; b < column_block; ++b) {
+                            Fr::__copy(columns[b * num_rows + k1], dest[b]);
+                        }
+                    }
+                }
+            }
+            aligned_free(twiddles);
+            aligned_free(columns);
+        }
+
+#ifndef NO_MULTITHREADING
+#pragma omp for
+#endif
+        for (size_t j = 0; j < num_threads; ++j) {
+            const auto [start, end] = max_threads::get_thread_range(num_rows / row_block, num_threads, j);
+            for (size_t block = start; block < end; ++block) {
+                const size_t row_start = block * row_block;
+                for (size_t p = 0; p < num_polys; ++p) {
+                    Fr* matrix = &scratch_space[p * domain.size];
+                    for (size_t b = 0; b < row_block; ++b) {
+                        Fr* row = &matrix[(row_start + b) * num_columns];
+                        for (size_t i = 0; i < num_columns; ++i) {
+                            const size_t swap_index =
+                                reverse_bits(static_cast<uint32_t>(i), static_cast<uint32_t>(log2_num_columns));
+                            if (i < swap_index) {
+                                Fr::__swap(row[i], row[swap_index]);
+                            }
+                        }
+                        fft_butterflies_serial(row, num_columns, root_table);
+                    }
+                    // transpose the block of rows into the output
+                    for (size_t k2 = 0; k2 < num_columns; ++k2) {
+                        Fr* dest = &target[p][k2 * num_rows + row_start];
+                        for (size_t b = 0; b < row_block; ++b) {
+                            Fr::__copy(matrix[(row_start + b) * num_columns + k2], dest[b]);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+} // namespace
+
 template <typename Fr>
 void fft_inner_parallel(std::vector<Fr*> coeffs,
                         const EvaluationDomain<Fr>& domain,
-                        const Fr&,
+                        const Fr& root,
                         const std::vector<Fr*>& root_table)
 {
+    if (domain.fft_algorithm == FFTAlgorithm::FOUR_STEP && coeffs.size() == 1 && domain.log2_size >= 2) {
+        fft_inner_four_step<Fr>({ coeffs[0] }, { coeffs[0] }, domain, root, root_table);
+        return;
+    }
     Fr* scratch_space = get_scratch_space<Fr>(domain.size);
 
     const size_t num_polys = coeffs.size();
@@ -178,6 +409,7 @@ void fft_inner_parallel(std::vector<Fr*> coeffs,
     ASSERT(is_power_of_two(poly_size));
     const size_t poly_mask = poly_size - 1;
     const size_t log2_poly_size = (size_t)numeric::get_msb(poly_size);
+    const size_t num_threads = compute_fft_num_threads(domain.size);
 
 #ifndef NO_MULTITHREADING
 #pragma omp parallel
@@ -188,10 +420,11 @@ void fft_inner_parallel(std::vector<Fr*> coeffs,
 #ifndef NO_MULTITHREADING
 #pragma omp for
 #endif
-        for (size_t j = 0; j < domain.num_threads; ++j) {
+        for (size_t j = 0; j < num_threads; ++j) {
             Fr temp_1;
             Fr temp_2;
-            for (size_t i = (j * domain.thread_size); i < ((j + 1) * domain.thread_size); i += 2) {
+            const auto [start, end] = max_threads::get_thread_range(domain.size, num_threads, j, 2);
+            for (size_t i = start; i < end; i += 2) {
                 uint32_t next_index_1 = (uint32_t)reverse_bits((uint32_t)i + 2, (uint32_t)domain.log2_size);
                 uint32_t next_index_2 = (uint32_t)reverse_bits((uint32_t)i + 3, (uint32_t)domain.log2_size);
                 __builtin_prefetch(&coeffs[next_index_1]);
@@ -224,7 +457,7 @@ void fft_inner_parallel(std::vector<Fr*> coeffs,
 #ifndef NO_MULTITHREADING
 #pragma omp for
 #endif
-            for (size_t j = 0; j < domain.num_threads; ++j) {
+            for (size_t j = 0; j < num_threads; ++j) {
                 Fr temp;
 
                 // Ok! So, what's going on here? This is the inner loop of the FFT algorithm, and we want to break it
@@ -234,8 +467,7 @@ void fft_inner_parallel(std::vector<Fr*> coeffs,
 
                 // Here, `start` and `end` are used as our iterator limits, so that we can use our iterator `i` to
                 // directly access the roots of unity lookup table
-                const size_t start = j * (domain.thread_size >> 1);
-                const size_t end = (j + 1) * (domain.thread_size >> 1);
+                const auto [start, end] = max_threads::get_thread_range(domain.size >> 1, num_threads, j);
 
                 // For all but the last round of our FFT, the roots of unity that we need, will be a subset of our
                 // lookup table. e.g. for a size 2^n FFT, the 2^n'th roots create a multiplicative subgroup of order 2^n
@@ -276,13 +508,9 @@ void fft_inner_parallel(std::vector<Fr*> coeffs,
                 // so that we can reduce out of our 'coarse' reduction and store the output in `coeffs` instead of
                 // `scratch_space`
                 if (m != (domain.size >> 1)) {
-                    for (size_t i = start; i < end; ++i) {
-                        size_t k1 = (i & index_mask) << 1;
-                        size_t j1 = i & block_mask;
-                        temp = round_roots[j1] * scratch_space[k1 + j1 + m];
-                        scratch_space[k1 + j1 + m] = scratch_space[k1 + j1] - temp;
-                        scratch_space[k1 + j1] += temp;
-                    }
+                    fft_round_butterflies(scratch_space, scratch_space, round_roots, m, start, end);
+                } else if (num_polys == 1) {
+                    fft_round_butterflies(scratch_space, coeffs[0], round_roots, m, start, end);
                 } else {
                     for (size_t i = start; i < end; ++i) {
                         size_t k1 = (i & index_mask) << 1;
@@ -305,8 +533,13 @@ void fft_inner_parallel(std::vector<Fr*> coeffs,
 
 template <typename Fr>
 void fft_inner_parallel(
-    Fr* coeffs, Fr* target, const EvaluationDomain<Fr>& domain, const Fr&, const std::vector<Fr*>& root_table)
+    Fr* coeffs, Fr* target, const EvaluationDomain<Fr>& domain, const Fr& root, const std::vector<Fr*>& root_table)
 {
+    if (domain.fft_algorithm == FFTAlgorithm::FOUR_STEP && domain.log2_size >= 2) {
+        fft_inner_four_step<Fr>({ coeffs }, { target }, domain, root, root_table);
+        return;
+    }
+    const size_t num_threads = compute_fft_num_threads(domain.size);
 #ifndef NO_MULTITHREADING
 #pragma omp parallel
 #endif
@@ -316,10 +549,11 @@ void fft_inner_parallel(
 #ifndef NO_MULTITHREADING
 #pragma omp for
 #endif
-        for (size_t j = 0; j < domain.num_threads; ++j) {
+        for (size_t j = 0; j < num_threads; ++j) {
             Fr temp_1;
             Fr temp_2;
-            for (size_t i = (j * domain.thread_size); i < ((j + 1) * domain.thread_size); i += 2) {
+            const auto [start, end] = max_threads::get_thread_range(domain.size, num_threads, j, 2);
+            for (size_t i = start; i < end; i += 2) {
                 uint32_t next_index_1 = (uint32_t)reverse_bits((uint32_t)i + 2, (uint32_t)domain.log2_size);
                 uint32_t next_index_2 = (uint32_t)reverse_bits((uint32_t)i + 3, (uint32_t)domain.log2_size);
                 __builtin_prefetch(&coeffs[next_index_1]);
@@ -347,63 +581,99 @@ void fft_inner_parallel(
 #ifndef NO_MULTITHREADING
 #pragma omp for
 #endif
-            for (size_t j = 0; j < domain.num_threads; ++j) {
-                Fr temp;
-
-                // Ok! So, what's going on here? This is the inner loop of the FFT algorithm, and we want to break it
-                // out into multiple independent threads. For `num_threads`, each thread will evaluation `domain.size /
-                // num_threads` of the polynomial. The actual iteration length will be half of this, because we leverage
-                // the fact that \omega^{n/2} = -\omega (where \omega is a root of unity)
-
-                // Here, `start` and `end` are used as our iterator limits, so that we can use our iterator `i` to
-                // directly access the roots of unity lookup table
-                const size_t start = j * (domain.thread_size >> 1);
-                const size_t end = (j + 1) * (domain.thread_size >> 1);
+            for (size_t j = 0; j < num_threads; ++j) {
+                // See the vector variant above for how the flattened loop indexes the butterflies of a round
+                const auto [start, end] = max_threads::get_thread_range(domain.size >> 1, num_threads, j);
+                const Fr* round_roots = root_table[static_cast<size_t>(numeric::get_msb(m)) - 1];
+                fft_round_butterflies(target, target, round_roots, m, start, end);
+            }
+        }
+    }
+}
 
-                // For all but the last round of our FFT, the roots of unity that we need, will be a subset of our
-                // lookup table. e.g. for a size 2^n FFT, the 2^n'th roots create a multiplicative subgroup of order 2^n
-                //      the 1st round will use the roots from the multiplicative subgroup of order 2 : the 2'th roots of
-                //      unity the 2nd round will use the roots from the multiplicative subgroup of order 4 : the 4'th
-                //      roots of unity
-                // i.e. each successive FFT round will double the set of roots that we need to index.
-                // We have already laid out the `root_table` container so that each FFT round's roots are linearly
-                // ordered in memory. For all FFT rounds, the number of elements we're iterating over is greater than
-                // the size of our lookup table. We need to access this table in a cyclical fasion - i.e. for a subgroup
-                // of size x, the first x iterations will index the subgroup elements in order, then for the next x
-                // iterations, we loop back to the start.
+/**
+ * In-place FFT of several polynomials over the same domain.
+ *
+ * Rather than transforming the polynomials one after the other, every butterfly round is applied to all of them before
+ * moving on. Each run of `BUTTERFLY_BATCH_SIZE` butterflies is applied to every polynomial in turn, so its roots of
+ * unity are loaded from memory once and stay in L1 for the other polynomials. The butterflies of different
+ * polynomials are independent, so they can be pipelined.
+ *
+ * Four-step domains transform the polynomials block by block instead, `FOUR_STEP_MAX_BATCH_SIZE` at a time, see
+ * `fft_inner_four_step`.
+ **/
+template <typename Fr>
+void fft_inner_batch(const std::vector<Fr*>& polys,
+                     const EvaluationDomain<Fr>& domain,
+                     const Fr& root,
+                     const std::vector<Fr*>& root_table)
+{
+    if (domain.fft_algorithm == FFTAlgorithm::FOUR_STEP && domain.log2_size >= 2) {
+        for (size_t i = 0; i < polys.size(); i += FOUR_STEP_MAX_BATCH_SIZE) {
+            const auto group_end = polys.begin() + (std::ptrdiff_t)std::min(i + FOUR_STEP_MAX_BATCH_SIZE, polys.size());
+            const std::vector<Fr*> group(polys.begin() + (std::ptrdiff_t)i, group_end);
+            fft_inner_four_step(std::vector<const Fr*>(group.begin(), group.end()), group, domain, root, root_table);
+        }
+        return;
+    }
+    if (domain.size < 2) {
+        return;
+    }
+    const size_t num_polys = polys.size();
+    const size_t num_threads = compute_fft_num_threads(domain.size);
 
-                // We could implement the algorithm by having 2 nested loops (where the inner loop iterates over the
-                // root table), but we want to flatten this out - as for the first few rounds, the inner loop will be
-                // tiny and we'll have quite a bit of unneccesary branch checks For each iteration of our flattened
-                // loop, indexed by `i`, the element of the root table we need to access will be `i % (current round
-                // subgroup size)` Given that each round subgroup size is `m`, which is a power of 2, we can index the
-                // root table with a very cheap `i & (m - 1)` Which is why we have this odd `block_mask` variable
-                const size_t block_mask = m - 1;
+#ifndef NO_MULTITHREADING
+#pragma omp parallel
+#endif
+    {
+        // Bit-reversal permutation. Each swap is owned by the smaller of its two indices
+#ifndef NO_MULTITHREADING
+#pragma omp for
+#endif
+        for (size_t j = 0; j < num_threads; ++j) {
+            const auto [start, end] = max_threads::get_thread_range(domain.size, num_threads, j);
+            for (size_t i = start; i < end; ++i) {
+                const size_t swap_index =
+                    reverse_bits(static_cast<uint32_t>(i), static_cast<uint32_t>(domain.log2_size));
+                if (i < swap_index) {
+                    for (size_t k = 0; k < num_polys; ++k) {
+                        Fr::__swap(polys[k][i], polys[k][swap_index]);
+                    }
+                }
+            }
+        }
 
-                // The next problem to tackle, is we now need to efficiently index the polynomial element in
-                // `scratch_space` in our flattened loop If we used nested loops, the outer loop (e.g. `y`) iterates
-                // from 0 to 'domain size', in steps of 2 * m, with the inner loop (e.g. `z`) iterating from 0 to m. We
-                // have our inner loop indexer with `i & (m - 1)`. We need to add to this our outer loop indexer, which
-                // is equivalent to taking our indexer `i`, masking out the bits used in the 'inner loop', and doubling
-                // the result. i.e. polynomial indexer = (i & (m - 1)) + ((i & ~(m - 1)) >> 1) To simplify this, we
-                // cache index_mask = ~block_mask, meaning that our indexer is just `((i & index_mask) << 1 + (i &
-                // block_mask)`
-                const size_t index_mask = ~block_mask;
+        // First round: all roots are 1
+#ifndef NO_MULTITHREADING
+#pragma omp for
+#endif
+        for (size_t j = 0; j < num_threads; ++j) {
+            Fr temp;
+            const auto [start, end] = max_threads::get_thread_range(domain.size >> 1, num_threads, j);
+            for (size_t i = start; i < end; ++i) {
+                for (size_t k = 0; k < num_polys; ++k) {
+                    Fr* poly = polys[k];
+                    Fr::__copy(poly[2 * i + 1], temp);
+                    poly[2 * i + 1] = poly[2 * i] - temp;
+                    poly[2 * i] += temp;
+                }
+            }
+        }
 
-                // `round_roots` fetches the pointer to this round's lookup table. We use `numeric::get_msb(m) - 1` as
-                // our indexer, because we don't store the precomputed root values for the 1st round (because they're
-                // all 1).
+        // Remaining rounds, flattened as in `fft_inner_parallel`
+        for (size_t m = 2; m < domain.size; m <<= 1) {
+#ifndef NO_MULTITHREADING
+#pragma omp for
+#endif
+            for (size_t j = 0; j < num_threads; ++j) {
+                const auto [start, end] = max_threads::get_thread_range(domain.size >> 1, num_threads, j);
                 const Fr* round_roots = root_table[static_cast<size_t>(numeric::get_msb(m)) - 1];
-
-                // Finally, we want to treat the final round differently from the others,
-                // so that we can reduce out of our 'coarse' reduction and store the output in `coeffs` instead of
-                // `scratch_space`
-                for (size_t i = start; i < end; ++i) {
-                    size_t k1 = (i & index_mask) << 1;
-                    size_t j1 = i & block_mask;
-                    temp = round_roots[j1] * target[k1 + j1 + m];
-                    target[k1 + j1 + m] = target[k1 + j1] - temp;
-                    target[k1 + j1] += temp;
+                // apply each run of butterflies to every polynomial while its roots are still in L1
+                for (size_t i = start; i < end; i += BUTTERFLY_BATCH_SIZE) {
+                    const size_t run_end = std::min(i + BUTTERFLY_BATCH_SIZE, end);
+                    for (Fr* poly : polys) {
+                        fft_round_butterflies(poly, poly, round_roots, m, i, run_end);
+                    }
                 }
             }
         }
@@ -649,12 +919,12 @@ void coset_fft(Fr* coeffs,
     }
 
     if (domain_extension == 4) {
+        const size_t num_threads = compute_fft_num_threads(domain.size);
 #ifndef NO_MULTITHREADING
 #pragma omp parallel for
 #endif
-        for (size_t j = 0; j < domain.num_threads; ++j) {
-            const size_t start = j * domain.thread_size;
-            const size_t end = (j + 1) * domain.thread_size;
+        for (size_t j = 0; j < num_threads; ++j) {
+            const auto [start, end] = max_threads::get_thread_range(domain.size, num_threads, j);
             for (size_t i = start; i < end; ++i) {
                 Fr::__copy(scratch_space[i], coeffs[(i << 2UL)]);
                 Fr::__copy(scratch_space[i + (1UL << domain.log2_size)], coeffs[(i << 2UL) + 1UL]);
@@ -721,6 +991,45 @@ template <typename Fr> void coset_ifft(std::vector<Fr*> coeffs, const Evaluation
     }
 }
 
+template <typename Fr> void fft_batch(const std::vector<Fr*>& polys, const EvaluationDomain<Fr>& domain)
+{
+    fft_inner_batch(polys, domain, domain.root, domain.get_round_roots());
+}
+
+template <typename Fr> void ifft_batch(const std::vector<Fr*>& polys, const EvaluationDomain<Fr>& domain)
+{
+    fft_inner_batch(polys, domain, domain.root_inverse, domain.get_inverse_round_roots());
+    const size_t num_threads = compute_fft_num_threads(domain.size);
+#ifndef NO_MULTITHREADING
+#pragma omp parallel for
+#endif
+    for (size_t j = 0; j < num_threads; ++j) {
+        const auto [start, end] = max_threads::get_thread_range(domain.size, num_threads, j);
+        for (Fr* poly : polys) {
+            for (size_t i = start; i < end; ++i) {
+                poly[i] *= domain.domain_inverse;
+            }
+        }
+    }
+}
+
+template <typename Fr> void coset_fft_batch(const std::vector<Fr*>& polys, const EvaluationDomain<Fr>& domain)
+{
+    for (Fr* poly : polys) {
+        scale_by_generator(poly, poly, domain, Fr::one(), domain.generator, domain.generator_size);
+    }
+    fft_batch(polys, domain);
+}
+
+template <typename Fr> void coset_ifft_batch(const std::vector<Fr*>& polys, const EvaluationDomain<Fr>& domain)
+{
+    fft_inner_batch(polys, domain, domain.root_inverse, domain.get_inverse_round_roots());
+    // fold the 1/n normalisation into the coset shift
+    for (Fr* poly : polys) {
+        scale_by_generator(poly, poly, domain, domain.domain_inverse, domain.generator_inverse, domain.size);
+    }
+}
+
 template <typename Fr>
 void add(const Fr* a_coeffs, const Fr* b_coeffs, Fr* r_coeffs, const EvaluationDomain<Fr>& domain)
 {
@@ -748,7 +1057,7 @@ void mul(const Fr* a_coeffs, const Fr* b_coeffs, Fr* r_coeffs, const EvaluationD
 template <typename Fr> Fr evaluate(const Fr* coeffs, const Fr& z, const size_t n)
 {
 #ifndef NO_MULTITHREADING
-    size_t num_threads = max_threads::compute_num_threads();
+    size_t num_threads = max_threads::compute_num_threads_unrounded();
 #else
     size_t num_threads = 1;
 #endif
@@ -785,7 +1094,7 @@ template <typename Fr> Fr evaluate(const std::vector<Fr*> coeffs, const Fr& z, c
     ASSERT(is_power_of_two(poly_size));
     const size_t log2_poly_size = (size_t)numeric::get_msb(poly_size);
 #ifndef NO_MULTITHREADING
-    size_t num_threads = max_threads::compute_num_threads();
+    size_t num_threads = max_threads::compute_num_threads_unrounded();
 #else
     size_t num_threads = 1;
 #endif
@@ -1014,6 +1323,45 @@ void divide_by_pseudo_vanishing_polynomial(std::vector<Fr*> coeffs,
     delete[] subgroup_roots;
 }
 
+template <typename Fr> void compute_partial_products(std::span<Fr> coeffs)
+{
+    const size_t n = coeffs.size();
+    const size_t num_threads = compute_fft_num_threads(n);
+
+    // range_products[j] = product of the coefficients in thread j's range
+    std::vector<Fr> range_products(num_threads, Fr::one());
+#ifndef NO_MULTITHREADING
+#pragma omp parallel for
+#endif
+    for (size_t j = 0; j < num_threads; ++j) {
+        const auto [start, end] = max_threads::get_thread_range(n, num_threads, j);
+        for (size_t i = start + 1; i < end; ++i) {
+            coeffs[i] *= coeffs[i - 1];
+        }
+        if (end > start) {
+            range_products[j] = coeffs[end - 1];
+        }
+    }
+
+    // range_products[j] = product of the coefficients before thread j's range
+    Fr running_product = Fr::one();
+    for (size_t j = 0; j < num_threads; ++j) {
+        const Fr range_product = range_products[j];
+        range_products[j] = running_product;
+        running_product *= range_product;
+    }
+
+#ifndef NO_MULTITHREADING
+#pragma omp parallel for
+#endif
+    for (size_t j = 1; j < num_threads; ++j) {
+        const auto [start, end] = max_threads::get_thread_range(n, num_threads, j);
+        for (size_t i = start; i < end; ++i) {
+            coeffs[i] *= range_products[j];
+        }
+    }
+}
+
 template <typename Fr> Fr compute_kate_opening_coefficients(const Fr* src, Fr* dest, const Fr& z, const size_t n)
 {
     // if `coeffs` represents F(X), we want to compute W(X)
@@ -1384,6 +1732,10 @@ template void ifft<fr>(std::vector<fr*>, const EvaluationDomain<fr>&);
 template void ifft_with_constant<fr>(fr*, const EvaluationDomain<fr>&, const fr&);
 template void coset_ifft<fr>(fr*, const EvaluationDomain<fr>&);
 template void coset_ifft<fr>(std::vector<fr*>, const EvaluationDomain<fr>&);
+template void fft_batch<fr>(const std::vector<fr*>&, const EvaluationDomain<fr>&);
+template void ifft_batch<fr>(const std::vector<fr*>&, const EvaluationDomain<fr>&);
+template void coset_fft_batch<fr>(const std::vector<fr*>&, const EvaluationDomain<fr>&);
+template void coset_ifft_batch<fr>(const std::vector<fr*>&, const EvaluationDomain<fr>&);
 template void partial_fft_serial_inner<fr>(fr*, fr*, const EvaluationDomain<fr>&, const std::vector<fr*>&);
 template void partial_fft_parellel_inner<fr>(fr*, const EvaluationDomain<fr>&, const std::vector<fr*>&, fr, bool);
 template void partial_fft_serial<fr>(fr*, fr*, const EvaluationDomain<fr>&);
@@ -1392,6 +1744,7 @@ template void add<fr>(const fr*, const fr*, fr*, const EvaluationDomain<fr>&);
 template void sub<fr>(const fr*, const fr*, fr*, const EvaluationDomain<fr>&);
 template void mul<fr>(const fr*, const fr*, fr*, const EvaluationDomain<fr>&);
 template void compute_lagrange_polynomial_fft<fr>(fr*, const EvaluationDomain<fr>&, const EvaluationDomain<fr>&);
+template void compute_partial_products<fr>(std::span<fr>);
 template void divide_by_pseudo_vanishing_polynomial<fr>(std::vector<fr*>,
                                                         const EvaluationDomain<fr>&,
                                                         const EvaluationDomain<fr>&,
@@ -1446,6 +1799,10 @@ template void ifft_with_constant<grumpkin::fr>(grumpkin::fr*,
                                                const grumpkin::fr&);
 template void coset_ifft<grumpkin::fr>(grumpkin::fr*, const EvaluationDomain<grumpkin::fr>&);
 template void coset_ifft<grumpkin::fr>(std::vector<grumpkin::fr*>, const EvaluationDomain<grumpkin::fr>&);
+template void fft_batch<grumpkin::fr>(const std::vector<grumpkin::fr*>&, const EvaluationDomain<grumpkin::fr>&);
+template void ifft_batch<grumpkin::fr>(const std::vector<grumpkin::fr*>&, const EvaluationDomain<grumpkin::fr>&);
+template void coset_fft_batch<grumpkin::fr>(const std::vector<grumpkin::fr*>&, const EvaluationDomain<grumpkin::fr>&);
+template void coset_ifft_batch<grumpkin::fr>(const std::vector<grumpkin::fr*>&, const EvaluationDomain<grumpkin::fr>&);
 template void partial_fft_serial_inner<grumpkin::fr>(grumpkin::fr*,
                                                      grumpkin::fr*,
                                                      const EvaluationDomain<grumpkin::fr>&,
@@ -1469,6 +1826,7 @@ template void mul<grumpkin::fr>(const grumpkin::fr*,
 template void compute_lagrange_polynomial_fft<grumpkin::fr>(grumpkin::fr*,
                                                             const EvaluationDomain<grumpkin::fr>&,
                                                             const EvaluationDomain<grumpkin::fr>&);
+template void compute_partial_products<grumpkin::fr>(std::span<grumpkin::fr>);
 template void divide_by_pseudo_vanishing_polynomial<grumpkin::fr>(std::vector<grumpkin::fr*>,
                                                                   const EvaluationDomain<grumpkin::fr>&,
                                                                   const EvaluationDomain<grumpkin::fr>&,
@@ -64,6 +64,14 @@ template <typename Fr> void ifft_with_constant(Fr* coeffs, const EvaluationDomai
 template <typename Fr> void coset_ifft(Fr* coeffs, const EvaluationDomain<Fr>& domain);
 template <typename Fr> void coset_ifft(std::vector<Fr*> coeffs, const EvaluationDomain<Fr>& domain);
 
+// Transform several independent polynomials, each of size domain.size, in place. Unlike the overloads above that take
+// a std::vector, which treat the vector as the parts of ONE polynomial, these transform every entry separately.
+// The butterflies of all polynomials share one pass over the root tables.
+template <typename Fr> void fft_batch(const std::vector<Fr*>& polys, const EvaluationDomain<Fr>& domain);
+template <typename Fr> void ifft_batch(const std::vector<Fr*>& polys, const EvaluationDomain<Fr>& domain);
+template <typename Fr> void coset_fft_batch(const std::vector<Fr*>& polys, const EvaluationDomain<Fr>& domain);
+template <typename Fr> void coset_ifft_batch(const std::vector<Fr*>& polys, const EvaluationDomain<Fr>& domain);
+
 template <typename Fr>
 void partial_fft_serial_inner(Fr* coeffs,
                               Fr* target,
@@ -105,6 +113,11 @@ void divide_by_pseudo_vanishing_polynomial(std::vector<Fr*> coeffs,
                                            const EvaluationDomain<Fr>& target_domain,
                                            const size_t num_roots_cut_out_of_vanishing_polynomial = 4);
 
+// Replace every coefficient with the product of itself and all the coefficients before it, i.e.
+// coeffs[i] = \prod_{j <= i} coeffs[j]. The ranges of each thread are multiplied out in parallel and then rescaled by
+// the product of the preceding ranges, so this costs up to 2 multiplications per coefficient when multi-threaded.
+template <typename Fr> void compute_partial_products(std::span<Fr> coeffs);
+
 // void populate_with_vanishing_polynomial(Fr* coeffs, const size_t num_non_zero_entries, const EvaluationDomain<Fr>&
 // src_domain, const EvaluationDomain<Fr>& target_domain);
 
@@ -355,6 +368,10 @@ extern template void ifft<fr>(std::vector<fr*>, const EvaluationDomain<fr>&);
 extern template void ifft_with_constant<fr>(fr*, const EvaluationDomain<fr>&, const fr&);
 extern template void coset_ifft<fr>(fr*, const EvaluationDomain<fr>&);
 extern template void coset_ifft<fr>(std::vector<fr*>, const EvaluationDomain<fr>&);
+extern template void fft_batch<fr>(const std::vector<fr*>&, const EvaluationDomain<fr>&);
+extern template void ifft_batch<fr>(const std::vector<fr*>&, const EvaluationDomain<fr>&);
+extern template void coset_fft_batch<fr>(const std::vector<fr*>&, const EvaluationDomain<fr>&);
+extern template void coset_ifft_batch<fr>(const std::vector<fr*>&, const EvaluationDomain<fr>&);
 extern template void partial_fft_serial_inner<fr>(fr*, fr*, const EvaluationDomain<fr>&, const std::vector<fr*>&);
 extern template void partial_fft_parellel_inner<fr>(
     fr*, const EvaluationDomain<fr>&, const std::vector<fr*>&, fr, bool);
@@ -368,6 +385,7 @@ extern template void divide_by_pseudo_vanishing_polynomial<fr>(std::vector<fr*>,
                                                                const EvaluationDomain<fr>&,
                                                                const EvaluationDomain<fr>&,
                                                                const size_t);
+extern template void compute_partial_products<fr>(std::span<fr>);
 extern template fr compute_kate_opening_coefficients<fr>(const fr*, fr*, const fr&, const size_t);
 extern template LagrangeEvaluations<fr> get_lagrange_evaluations<fr>(const fr&,
                                                                      const EvaluationDomain<fr>&,
@@ -425,6 +443,12 @@ extern template void ifft_with_constant<grumpkin::fr>(grumpkin::fr*,
                                                       const grumpkin::fr&);
 extern template void coset_ifft<grumpkin::fr>(grumpkin::fr*, const EvaluationDomain<grumpkin::fr>&);
 extern template void coset_ifft<grumpkin::fr>(std::vector<grumpkin::fr*>, const EvaluationDomain<grumpkin::fr>&);
+extern template void fft_batch<grumpkin::fr>(const std::vector<grumpkin::fr*>&, const EvaluationDomain<grumpkin::fr>&);
+extern template void ifft_batch<grumpkin::fr>(const std::vector<grumpkin::fr*>&, const EvaluationDomain<grumpkin::fr>&);
+extern template void coset_fft_batch<grumpkin::fr>(const std::vector<grumpkin::fr*>&,
+                                                   const EvaluationDomain<grumpkin::fr>&);
+extern template void coset_ifft_batch<grumpkin::fr>(const std::vector<grumpkin::fr*>&,
+                                                    const EvaluationDomain<grumpkin::fr>&);
 extern template void partial_fft_serial_inner<grumpkin::fr>(grumpkin::fr*,
                                                             grumpkin::fr*,
                                                             const EvaluationDomain<grumpkin::fr>&,
@@ -457,6 +481,7 @@ extern template void divide_by_pseudo_vanishing_polynomial<grumpkin::fr>(std::ve
                                                                          const EvaluationDomain<grumpkin::fr>&,
                                                                          const EvaluationDomain<grumpkin::fr>&,
                                                                          const size_t);
+extern template void compute_partial_products<grumpkin::fr>(std::span<grumpkin::fr>);
 extern template grumpkin::fr compute_kate_opening_coefficients<grumpkin::fr>(const grumpkin::fr*,
                                                                              grumpkin::fr*,
                                                                              const grumpkin::fr&,
@@ -8,6 +8,10 @@
 #include "barretenberg/numeric/random/engine.hpp"
 #include "polynomial.hpp"
 
+#ifndef NO_MULTITHREADING
+#include <omp.h>
+#endif
+
 using namespace barretenberg;
 
 TEST(polynomials, evaluation_domain)
@@ -173,6 +177,151 @@ TEST(polynomials, fft_ifft_consistency)
     }
 }
 
+#ifndef NO_MULTITHREADING
+TEST(polynomials, fft_non_power_of_two_threads)
+{
+    constexpr size_t n = 1024;
+    polynomial expected(n);
+    for (size_t i = 0; i < n; ++i) {
+        expected[i] = fr::random_element();
+    }
+    polynomial result(expected);
+
+    evaluation_domain domain = evaluation_domain(n);
+    domain.compute_lookup_table();
+    polynomial_arithmetic::coset_fft(expected.get_coefficients(), domain);
+
+    // the fft butterflies are split over every thread, not over the (power of two) domain partition
+    const int num_threads = omp_get_max_threads();
+    omp_set_num_threads(3);
+    polynomial_arithmetic::coset_fft(result.get_coefficients(), domain);
+    omp_set_num_threads(num_threads);
+
+    for (size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(result[i], expected[i]);
+    }
+}
+#endif
+
+TEST(polynomials, four_step_fft)
+{
+    // cover both square (even log) and rectangular (odd log) matrix shapes
+    for (size_t log2_n = 2; log2_n <= 11; ++log2_n) {
+        const size_t n = 1UL << log2_n;
+        polynomial coefficients(n);
+        for (size_t i = 0; i < n; ++i) {
+            coefficients[i] = fr::random_element();
+        }
+
+        evaluation_domain radix_2_domain = evaluation_domain(n);
+        radix_2_domain.compute_lookup_table();
+        evaluation_domain four_step_domain = evaluation_domain(n, 0, FFTAlgorithm::FOUR_STEP);
+        four_step_domain.compute_lookup_table();
+
+        polynomial expected(coefficients);
+        polynomial result(coefficients);
+        polynomial_arithmetic::fft(expected.get_coefficients(), radix_2_domain);
+        polynomial_arithmetic::fft(result.get_coefficients(), four_step_domain);
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(result[i], expected[i]);
+        }
+
+        polynomial_arithmetic::coset_fft(expected.get_coefficients(), radix_2_domain);
+        polynomial_arithmetic::coset_fft(result.get_coefficients(), four_step_domain);
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(result[i], expected[i]);
+        }
+
+        polynomial target(n);
+        polynomial_arithmetic::fft(result.get_coefficients(), target.get_coefficients(), four_step_domain);
+        polynomial_arithmetic::fft(expected.get_coefficients(), radix_2_domain);
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(target[i], expected[i]);
+        }
+
+        polynomial_arithmetic::ifft(target.get_coefficients(), four_step_domain);
+        polynomial_arithmetic::coset_ifft(target.get_coefficients(), four_step_domain);
+        polynomial_arithmetic::ifft(target.get_coefficients(), four_step_domain);
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(target[i], coefficients[i]);
+        }
+    }
+}
+
+TEST(polynomials, four_step_extended_coset_fft)
+{
+    // The extended coset FFT writes the FFT of each coset into scratch space, so the four-step FFT must not use the
+    // same scratch space for its own working memory.
+    for (const size_t domain_extension : { 2UL, 4UL }) {
+        for (size_t log2_n = 2; log2_n <= 9; ++log2_n) {
+            const size_t n = 1UL << log2_n;
+            evaluation_domain radix_2_domain = evaluation_domain(n);
+            radix_2_domain.compute_lookup_table();
+            evaluation_domain four_step_domain = evaluation_domain(n, 0, FFTAlgorithm::FOUR_STEP);
+            four_step_domain.compute_lookup_table();
+            evaluation_domain large_domain = evaluation_domain(n * domain_extension);
+            large_domain.compute_lookup_table();
+
+            polynomial expected(n * domain_extension);
+            for (size_t i = 0; i < n; ++i) {
+                expected[i] = fr::random_element();
+            }
+            polynomial result(expected);
+            polynomial_arithmetic::coset_fft(
+                expected.get_coefficients(), radix_2_domain, large_domain, domain_extension);
+            polynomial_arithmetic::coset_fft(
+                result.get_coefficients(), four_step_domain, large_domain, domain_extension);
+            for (size_t i = 0; i < n * domain_extension; ++i) {
+                EXPECT_EQ(result[i], expected[i]);
+            }
+        }
+    }
+}
+
+TEST(polynomials, batch_fft)
+{
+    constexpr size_t n = 512;
+    constexpr size_t num_polys = 5;
+    for (const auto algorithm : { FFTAlgorithm::RADIX_2, FFTAlgorithm::FOUR_STEP }) {
+        evaluation_domain domain = evaluation_domain(n, 0, algorithm);
+        domain.compute_lookup_table();
+
+        std::vector<polynomial> coefficients;
+        std::vector<polynomial> expected;
+        std::vector<polynomial> result;
+        std::vector<fr*> result_data;
+        for (size_t j = 0; j < num_polys; ++j) {
+            coefficients.emplace_back(n);
+            for (size_t i = 0; i < n; ++i) {
+                coefficients[j][i] = fr::random_element();
+            }
+            expected.emplace_back(coefficients[j]);
+            result.emplace_back(coefficients[j]);
+        }
+        for (auto& poly : result) {
+            result_data.push_back(poly.get_coefficients());
+        }
+
+        polynomial_arithmetic::fft_batch(result_data, domain);
+        polynomial_arithmetic::coset_fft_batch(result_data, domain);
+        for (size_t j = 0; j < num_polys; ++j) {
+            polynomial_arithmetic::fft(expected[j].get_coefficients(), domain);
+            polynomial_arithmetic::coset_fft(expected[j].get_coefficients(), domain);
+            for (size_t i = 0; i < n; ++i) {
+                EXPECT_EQ(result[j][i], expected[j][i]);
+            }
+        }
+
+        polynomial_arithmetic::coset_ifft_batch(result_data, domain);
+        polynomial_arithmetic::ifft_batch(result_data, domain);
+        for (size_t j = 0; j < num_polys; ++j) {
+            for (size_t i = 0; i < n; ++i) {
+                EXPECT_EQ(result[j][i], coefficients[j][i]);
+            }
+        }
+    }
+}
+
 TEST(polynomials, split_polynomial_fft_ifft_consistency)
 {
     constexpr size_t n = 256;
@@ -435,6 +584,23 @@ TEST(polynomials, compute_lagrange_polynomial_fft_large_domain)
     }
 }
 
+TEST(polynomials, compute_partial_products)
+{
+    for (const size_t n : { 0UL, 1UL, 7UL, 1000UL }) {
+        std::vector<fr> coeffs(n);
+        for (auto& coeff : coeffs) {
+            coeff = fr::random_element();
+        }
+        std::vector<fr> expected(coeffs);
+        for (size_t i = 1; i < n; ++i) {
+            expected[i] *= expected[i - 1];
+        }
+
+        polynomial_arithmetic::compute_partial_products(std::span{ coeffs });
+        EXPECT_EQ(coeffs, expected);
+    }
+}
+
 TEST(polynomials, divide_by_pseudo_vanishing_polynomial)
 {
     constexpr size_t n = 256;
@@ -417,4 +417,91 @@ TEST(standard_circuit_constructor, test_check_circuit_broken)
     EXPECT_EQ(result, false);
 }
 
+TEST(standard_circuit_constructor, assert_equal_merges_classes)
+{
+    StandardCircuitConstructor composer = StandardCircuitConstructor();
+    constexpr size_t num_classes = 4;
+    constexpr size_t class_size = 100;
+    fr values[num_classes];
+    std::vector<uint32_t> indices[num_classes];
+    for (size_t j = 0; j < num_classes; ++j) {
+        // The last two classes share a value, so that they can be joined below.
+        values[j] = j == num_classes - 1 ? values[j - 1] : fr::random_element();
+        for (size_t i = 0; i < class_size; ++i) {
+            indices[j].push_back(composer.add_variable(values[j]));
+        }
+    }
+    // Join each class up in a different order, so that either side of a call can be the larger class.
+    for (size_t i = 1; i < class_size; ++i) {
+        composer.assert_equal(indices[0][i], indices[0][i - 1]);
+        composer.assert_equal(indices[1][i - 1], indices[1][i]);
+        composer.assert_equal(indices[2][i], indices[2][i / 2]);
+        composer.assert_equal(indices[3][i / 2], indices[3][i]);
+    }
+    // Join two of them after they have been built up.
+    composer.assert_equal(indices[3][class_size / 2], indices[2][0]);
+    indices[2].insert(indices[2].end(), indices[3].begin(), indices[3].end());
+    indices[3].clear();
+    EXPECT_EQ(composer.failed(), false);
+
+    for (size_t j = 0; j < 3; ++j) {
+        const uint32_t real_idx = composer.real_variable_index[indices[j][0]];
+        // Each chain runs from its first variable to the real one through every member of the class exactly once.
+        std::vector<uint32_t> chain;
+        uint32_t cur_idx = composer.get_first_variable_in_class(indices[j][0]);
+        while (true) {
+            chain.push_back(cur_idx);
+            const uint32_t next_idx = composer.next_var_index[cur_idx];
+            if (next_idx == StandardCircuitConstructor::REAL_VARIABLE) {
+                break;
+            }
+            EXPECT_EQ(composer.prev_var_index[next_idx], cur_idx);
+            cur_idx = next_idx;
+        }
+        EXPECT_EQ(cur_idx, real_idx);
+        std::sort(chain.begin(), chain.end());
+        std::vector<uint32_t> expected = indices[j];
+        std::sort(expected.begin(), expected.end());
+        EXPECT_EQ(chain, expected);
+        for (auto idx : indices[j]) {
+            EXPECT_EQ(composer.real_variable_index[idx], real_idx);
+            EXPECT_EQ(composer.get_variable(idx), values[j]);
+        }
+    }
+
+    composer.create_add_gate(
+        { indices[0][3], indices[2][5], composer.add_variable(values[0] + values[2]), 1, 1, -1, 0 });
+    EXPECT_EQ(composer.check_circuit(), true);
+}
+
+TEST(standard_circuit_constructor, assert_equal_smaller_class_first)
+{
+    StandardCircuitConstructor composer = StandardCircuitConstructor();
+    const fr a_value = fr::random_element();
+    const fr b_value = a_value + 1;
+    const uint32_t a_idx = composer.add_variable(a_value);
+    std::vector<uint32_t> b_indices;
+    for (size_t i = 0; i < 5; ++i) {
+        b_indices.push_back(composer.add_variable(b_value));
+        if (i > 0) {
+            composer.assert_equal(b_indices[i], b_indices[0]);
+        }
+    }
+    const uint32_t b_real_idx = composer.real_variable_index[b_indices[0]];
+    composer.real_variable_tags[composer.real_variable_index[a_idx]] = 7;
+    EXPECT_EQ(composer.failed(), false);
+
+    // a's class is the smaller one, so it is relabelled into b's, but the merged class keeps a's value and tag.
+    composer.assert_equal(a_idx, b_indices[3], "values differ");
+    EXPECT_EQ(composer.failed(), true);
+    EXPECT_EQ(composer.err(), "values differ");
+    EXPECT_EQ(composer.real_variable_index[a_idx], b_real_idx);
+    EXPECT_EQ(composer.get_variable(a_idx), a_value);
+    for (auto idx : b_indices) {
+        EXPECT_EQ(composer.real_variable_index[idx], b_real_idx);
+        EXPECT_EQ(composer.get_variable(idx), a_value);
+    }
+    EXPECT_EQ(composer.real_variable_tags[b_real_idx], 7U);
+}
+
 } // namespace standard_circuit_constructor_tests
@@ -0,0 +1,35 @@
+#include "ultra_circuit_constructor.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace benchmark;
+using namespace barretenberg;
+
+namespace {
+auto& engine = numeric::random::get_debug_engine();
+}
+
+/**
+ * @brief Benchmark: finalizing an Ultra circuit dominated by range constraints, where most of the work is
+ * processing the range lists into sort constraints.
+ */
+void finalize_range_constrained_circuit(State& state) noexcept
+{
+    const auto num_constraints = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        state.PauseTiming();
+        proof_system::UltraCircuitConstructor circuit_constructor(num_constraints);
+        for (size_t i = 0; i < num_constraints; ++i) {
+            // Spread the constraints over a few lists, as in circuits mixing limb sizes.
+            const size_t num_bits = 8 + (i % 7);
+            const uint64_t value = engine.get_random_uint64() & ((1ULL << num_bits) - 1);
+            circuit_constructor.create_new_range_constraint(circuit_constructor.add_variable(value),
+                                                            (1ULL << num_bits) - 1);
+        }
+        state.ResumeTiming();
+
+        circuit_constructor.finalize_circuit();
+    }
+}
+BENCHMARK(finalize_range_constrained_circuit)->Unit(kMillisecond)->RangeMultiplier(4)->Range(1 << 14, 1 << 20);
+
+BENCHMARK_MAIN();
@@ -432,7 +432,7 @@ plookup::BasicTable& UltraCircuitConstructor::get_table(const plookup::BasicTabl
         }
     }
     // Table doesn't exist! So try to create it.
-    lookup_tables.emplace_back(plookup::create_basic_table(id, lookup_tables.size()));
+    lookup_tables.emplace_back(plookup::get_basic_table(id, lookup_tables.size()));
     return lookup_tables[lookup_tables.size() - 1];
 }
 
@@ -642,29 +642,45 @@ void UltraCircuitConstructor::create_new_range_constraint(const uint32_t variabl
             failure(msg);
         }
     }
-    if (range_lists.count(target_range) == 0) {
-        range_lists.insert({ target_range, create_range_list(target_range) });
+    auto it = range_lists.find(target_range);
+    if (it == range_lists.end()) {
+        it = range_lists.emplace(target_range, create_range_list(target_range)).first;
     }
 
-    auto& list = range_lists[target_range];
+    auto& list = it->second;
     assign_tag(variable_index, list.range_tag);
     list.variable_indices.emplace_back(variable_index);
 }
 
-void UltraCircuitConstructor::process_range_list(const RangeList& list)
+void UltraCircuitConstructor::process_range_list(RangeList& list)
 {
     assert_valid_variables(list.variable_indices);
 
     ASSERT(list.variable_indices.size() > 0);
+
+    // A variable that was copy constrained to another variable in the list shares its tag, so its value must only
+    // appear in the sorted list once. Replace every index with its real variable index and remove the duplicates.
+    for (auto& variable_index : list.variable_indices) {
+        variable_index = real_variable_index[variable_index];
+    }
+#ifdef NO_TBB
+    std::sort(list.variable_indices.begin(), list.variable_indices.end());
+#else
+    std::sort(std::execution::par_unseq, list.variable_indices.begin(), list.variable_indices.end());
+#endif
+    list.variable_indices.erase(std::unique(list.variable_indices.begin(), list.variable_indices.end()),
+                                list.variable_indices.end());
+
     // go over variables
     // for each variable, create mirror variable with same value - with tau tag
     // need to make sure that, in original list, increments of at most 3
-    std::vector<uint64_t> sorted_list;
-    sorted_list.reserve(list.variable_indices.size());
-    for (const auto variable_index : list.variable_indices) {
-        const auto& field_element = get_variable(variable_index);
-        const uint64_t shrinked_value = field_element.from_montgomery_form().data[0];
-        sorted_list.emplace_back(shrinked_value);
+    std::vector<uint64_t> sorted_list(list.variable_indices.size());
+#ifndef NO_MULTITHREADING
+#pragma omp parallel for
+#endif
+    for (size_t i = 0; i < list.variable_indices.size(); ++i) {
+        const auto& field_element = get_variable(list.variable_indices[i]);
+        sorted_list[i] = field_element.from_montgomery_form().data[0];
     }
 
 #ifdef NO_TBB
@@ -679,6 +695,7 @@ void UltraCircuitConstructor::process_range_list(const RangeList& list)
     size_t padding = (gate_width - (list.variable_indices.size() % gate_width)) % gate_width;
     if (list.variable_indices.size() <= gate_width)
         padding += gate_width;
+    indices.reserve(padding + sorted_list.size());
     for (size_t i = 0; i < padding; ++i) {
         indices.emplace_back(zero_idx);
     }
@@ -692,8 +709,38 @@ void UltraCircuitConstructor::process_range_list(const RangeList& list)
 
 void UltraCircuitConstructor::process_range_lists()
 {
-    for (const auto& i : range_lists)
-        process_range_list(i.second);
+    // Process the lists in order of target range, so that the circuit does not depend on the iteration order of
+    // `range_lists`.
+    std::vector<RangeList*> lists;
+    lists.reserve(range_lists.size());
+    size_t max_num_variables = 0;
+    size_t max_num_gates = 0;
+    for (auto& [target_range, list] : range_lists) {
+        lists.emplace_back(&list);
+        // At most one new variable per entry, and one gate per row of four plus the padding and closing gates.
+        max_num_variables += list.variable_indices.size();
+        max_num_gates += list.variable_indices.size() / plonk::ultra_settings::program_width + 3;
+    }
+    std::sort(lists.begin(), lists.end(), [](const RangeList* lhs, const RangeList* rhs) {
+        return lhs->target_range < rhs->target_range;
+    });
+
+    // Grow every variable, wire and selector vector once, rather than as each list is processed.
+    variables.reserve(variables.size() + max_num_variables);
+    real_variable_index.reserve(real_variable_index.size() + max_num_variables);
+    next_var_index.reserve(next_var_index.size() + max_num_variables);
+    prev_var_index.reserve(prev_var_index.size() + max_num_variables);
+    real_variable_tags.reserve(real_variable_tags.size() + max_num_variables);
+    for (auto& wire : wires) {
+        wire.reserve(wire.size() + max_num_gates);
+    }
+    for (auto& selector : selectors) {
+        selector.reserve(selector.size() + max_num_gates);
+    }
+
+    for (auto* list : lists) {
+        process_range_list(*list);
+    }
 }
 
 /*
@@ -814,25 +861,19 @@ void UltraCircuitConstructor::create_sort_constraint_with_edges(const std::vecto
     q_lookup_type.emplace_back(0);
     q_aux.emplace_back(0);
     // enforce range check for middle rows
+    // every middle row has the same selectors, so they are appended in bulk
+    const size_t num_middle_rows = variable_index.size() / gate_width - 2;
     for (size_t i = gate_width; i < variable_index.size() - gate_width; i += gate_width) {
-
         w_l.emplace_back(variable_index[i]);
         w_r.emplace_back(variable_index[i + 1]);
         w_o.emplace_back(variable_index[i + 2]);
         w_4.emplace_back(variable_index[i + 3]);
-        ++num_gates;
-        q_m.emplace_back(0);
-        q_1.emplace_back(0);
-        q_2.emplace_back(0);
-        q_3.emplace_back(0);
-        q_c.emplace_back(0);
-        q_arith.emplace_back(0);
-        q_4.emplace_back(0);
-        q_sort.emplace_back(1);
-        q_elliptic.emplace_back(0);
-        q_lookup_type.emplace_back(0);
-        q_aux.emplace_back(0);
     }
+    num_gates += num_middle_rows;
+    for (auto* selector : { &q_m, &q_1, &q_2, &q_3, &q_c, &q_arith, &q_4, &q_elliptic, &q_lookup_type, &q_aux }) {
+        selector->insert(selector->end(), num_middle_rows, fr(0));
+    }
+    q_sort.insert(q_sort.end(), num_middle_rows, fr(1));
     // enforce range checks of last row and ending at end
     if (variable_index.size() > gate_width) {
         w_l.emplace_back(variable_index[variable_index.size() - 4]);
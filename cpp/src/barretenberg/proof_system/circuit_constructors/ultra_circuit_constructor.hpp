@@ -10,6 +10,7 @@
 #include "barretenberg/plonk/composer/plookup_tables/plookup_tables.hpp"
 #include "barretenberg/plonk/proof_system/types/prover_settings.hpp"
 #include <optional>
+#include <unordered_map>
 
 namespace proof_system {
 
@@ -178,7 +179,8 @@ class UltraCircuitConstructor : public CircuitConstructorBase<arithmetization::U
 
     std::vector<plookup::BasicTable> lookup_tables;
     std::vector<plookup::MultiTable> lookup_multi_tables;
-    std::map<uint64_t, RangeList> range_lists; // DOCTODO: explain this.
+    // The range lists, keyed by target range. Each one holds the variables constrained to [0, target_range].
+    std::unordered_map<uint64_t, RangeList> range_lists;
 
     /**
      * @brief Each entry in ram_arrays represents an independent RAM table.
@@ -474,7 +476,7 @@ class UltraCircuitConstructor : public CircuitConstructorBase<arithmetization::U
     }
 
     RangeList create_range_list(const uint64_t target_range);
-    void process_range_list(const RangeList& list);
+    void process_range_list(RangeList& list);
     void process_range_lists();
 
     /**
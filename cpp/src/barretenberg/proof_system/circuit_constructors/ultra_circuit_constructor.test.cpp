@@ -0,0 +1,129 @@
+#include "ultra_circuit_constructor.hpp"
+#include <gtest/gtest.h>
+
+using namespace barretenberg;
+
+namespace {
+auto& engine = numeric::random::get_debug_engine();
+
+// The values of the real variables carrying `tag`, sorted. The generalised permutation counts each real variable once.
+std::vector<uint64_t> get_tagged_values(const proof_system::UltraCircuitConstructor& circuit_constructor,
+                                        const uint32_t tag)
+{
+    std::vector<uint64_t> result;
+    for (uint32_t i = 0; i < circuit_constructor.variables.size(); ++i) {
+        if (circuit_constructor.real_variable_index[i] == i && circuit_constructor.real_variable_tags[i] == tag) {
+            result.emplace_back(uint256_t(circuit_constructor.variables[i]).data[0]);
+        }
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+// Checks that every list's range and tau tagged values agree, and that the sort gates step by at most 3.
+void check_range_lists(const proof_system::UltraCircuitConstructor& circuit_constructor)
+{
+    for (const auto& [target_range, list] : circuit_constructor.range_lists) {
+        EXPECT_EQ(get_tagged_values(circuit_constructor, list.range_tag),
+                  get_tagged_values(circuit_constructor, list.tau_tag));
+    }
+
+    for (size_t i = 0; i + 1 < circuit_constructor.num_gates; ++i) {
+        if (circuit_constructor.q_sort[i] != fr(1)) {
+            continue;
+        }
+        const std::array<uint32_t, 5> row{ circuit_constructor.w_l[i],
+                                           circuit_constructor.w_r[i],
+                                           circuit_constructor.w_o[i],
+                                           circuit_constructor.w_4[i],
+                                           circuit_constructor.w_l[i + 1] };
+        for (size_t j = 0; j < 4; ++j) {
+            const uint256_t delta =
+                uint256_t(circuit_constructor.get_variable(row[j + 1]) - circuit_constructor.get_variable(row[j]));
+            EXPECT_LE(delta, uint256_t(3));
+        }
+    }
+}
+} // namespace
+
+namespace proof_system {
+
+TEST(ultra_circuit_constructor, range_lists)
+{
+    UltraCircuitConstructor circuit_constructor = UltraCircuitConstructor();
+    for (const uint64_t range : { 15ULL, 255ULL, (1ULL << 14) - 1 }) {
+        for (size_t i = 0; i < 100; ++i) {
+            const uint32_t index = circuit_constructor.add_variable(engine.get_random_uint64() % (range + 1));
+            circuit_constructor.create_new_range_constraint(index, range);
+        }
+    }
+    for (size_t i = 0; i < 50; ++i) {
+        const uint32_t index = circuit_constructor.add_variable(engine.get_random_uint64() & ((1ULL << 40) - 1));
+        circuit_constructor.create_range_constraint(index, 40, "range");
+    }
+    circuit_constructor.finalize_circuit();
+
+    EXPECT_FALSE(circuit_constructor.failed());
+    check_range_lists(circuit_constructor);
+}
+
+TEST(ultra_circuit_constructor, range_list_out_of_range)
+{
+    UltraCircuitConstructor circuit_constructor = UltraCircuitConstructor();
+    const uint32_t index = circuit_constructor.add_variable(16);
+    circuit_constructor.create_new_range_constraint(index, 15);
+    EXPECT_TRUE(circuit_constructor.failed());
+}
+
+TEST(ultra_circuit_constructor, range_list_copy_constrained_variables)
+{
+    // Variables in the same list that are later copy constrained share a real variable, which must only be sorted
+    // once.
+    UltraCircuitConstructor circuit_constructor = UltraCircuitConstructor();
+    const uint32_t a = circuit_constructor.add_variable(7);
+    const uint32_t b = circuit_constructor.add_variable(7);
+    const uint32_t c = circuit_constructor.add_variable(12);
+    circuit_constructor.create_new_range_constraint(a, 15);
+    circuit_constructor.create_new_range_constraint(b, 15);
+    circuit_constructor.create_new_range_constraint(c, 15);
+    circuit_constructor.assert_equal(a, b);
+    circuit_constructor.finalize_circuit();
+
+    EXPECT_FALSE(circuit_constructor.failed());
+    check_range_lists(circuit_constructor);
+}
+
+TEST(ultra_circuit_constructor, range_lists_are_deterministic)
+{
+    // The gates must not depend on the order the lists are stored in.
+    auto build = []() {
+        UltraCircuitConstructor circuit_constructor = UltraCircuitConstructor();
+        for (uint64_t range = 1; range < 200; range += 7) {
+            const uint32_t index = circuit_constructor.add_variable(range / 2);
+            circuit_constructor.create_new_range_constraint(index, range);
+        }
+        circuit_constructor.finalize_circuit();
+        return circuit_constructor;
+    };
+    auto first = build();
+    auto second = build();
+
+    EXPECT_EQ(first.wires, second.wires);
+    EXPECT_EQ(first.selectors, second.selectors);
+    EXPECT_EQ(first.variables, second.variables);
+    check_range_lists(first);
+
+    // The lists are emitted in order of target range, so their sort gates end in increasing order.
+    std::vector<fr> ends;
+    for (size_t i = 0; i < first.num_gates; ++i) {
+        if (first.q_sort[i] == fr(0) && i > 0 && first.q_sort[i - 1] == fr(1)) {
+            ends.emplace_back(-first.q_c[i]);
+        }
+    }
+    EXPECT_EQ(ends.size(), first.range_lists.size());
+    EXPECT_TRUE(std::is_sorted(ends.begin(), ends.end(), [](const fr& lhs, const fr& rhs) {
+        return uint256_t(lhs) < uint256_t(rhs);
+    }));
+}
+
+} // namespace proof_system
@@ -0,0 +1,52 @@
+#include "permutation_helper.hpp"
+#include "barretenberg/proof_system/circuit_constructors/standard_circuit_constructor.hpp"
+#include <benchmark/benchmark.h>
+#ifndef NO_MULTITHREADING
+#include <omp.h>
+#endif
+
+using namespace benchmark;
+using namespace barretenberg;
+
+namespace {
+auto& engine = numeric::random::get_debug_engine();
+
+// A standard circuit of additions of random earlier values, so that copy cycles have random lengths and their slots
+// are spread over the whole circuit.
+proof_system::StandardCircuitConstructor build_addition_circuit(const size_t num_gates)
+{
+    proof_system::StandardCircuitConstructor circuit_constructor(num_gates);
+    std::vector<uint32_t> indices{ circuit_constructor.add_variable(fr(1)) };
+    for (size_t i = 0; i < num_gates; ++i) {
+        const uint32_t a_idx = indices[engine.get_random_uint32() % indices.size()];
+        const uint32_t b_idx = indices[engine.get_random_uint32() % indices.size()];
+        const fr c = circuit_constructor.get_variable(a_idx) + circuit_constructor.get_variable(b_idx);
+        const uint32_t c_idx = circuit_constructor.add_variable(c);
+        circuit_constructor.create_add_gate({ a_idx, b_idx, c_idx, 1, 1, -1, 0 });
+        indices.push_back(c_idx);
+    }
+    return circuit_constructor;
+}
+} // namespace
+
+/**
+ * @brief Benchmark: bucketing the wire slots of a 2^range(0)-gate circuit into copy cycles with range(1) threads.
+ */
+void compute_wire_copy_cycles_bench(State& state) noexcept
+{
+    const auto circuit_constructor = build_addition_circuit(1UL << static_cast<size_t>(state.range(0)));
+#ifndef NO_MULTITHREADING
+    const int max_threads = omp_get_max_threads();
+    omp_set_num_threads(static_cast<int>(state.range(1)));
+#endif
+    for (auto _ : state) {
+        DoNotOptimize(proof_system::compute_wire_copy_cycles<3>(circuit_constructor));
+    }
+#ifndef NO_MULTITHREADING
+    omp_set_num_threads(max_threads);
+#endif
+}
+BENCHMARK(compute_wire_copy_cycles_bench)
+    ->Unit(kMillisecond)
+    ->ArgsProduct({ { 16, 20 }, { 1, 2, 4, 8 } })
+    ->ArgNames({ "log_gates", "threads" });
@@ -8,7 +8,9 @@
 
 #pragma once
 
+#include "barretenberg/common/max_threads.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "barretenberg/polynomials/iterate_over_domain.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
 #include "barretenberg/plonk/proof_system/proving_key/proving_key.hpp"
 
@@ -17,6 +19,8 @@
 #include <initializer_list>
 #include <cstdint>
 #include <cstddef>
+#include <numeric>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
@@ -25,8 +29,8 @@ namespace proof_system {
 
 /**
  * @brief cycle_node represents the index of a value of the circuit.
- * It will belong to a CyclicPermutation, such that all nodes in a CyclicPermutation
- * must have the value.
+ * It will be placed in the counting-sort bucket of the variable it holds, in WireCopyCycles, and all nodes in one
+ * bucket must have the same value.
  * The total number of constraints is always <2^32 since that is the type used to represent variables, so we can save
  * space by using a type smaller than size_t.
  */
@@ -54,18 +58,38 @@ template <size_t program_width> struct PermutationMapping {
     Mapping ids;
 };
 
-using CyclicPermutation = std::vector<cycle_node>;
+/**
+ * @brief The copy cycles of a circuit, one for each variable, stored back to back.
+ *
+ * @details The cycle of the variable with index v is nodes[offsets[v]], ..., nodes[offsets[v + 1] - 1]. Only real
+ * variables have non-empty cycles.
+ */
+struct WireCopyCycles {
+    std::vector<cycle_node> nodes;
+    std::vector<size_t> offsets;
+
+    std::span<const cycle_node> operator[](size_t variable_index) const
+    {
+        return { nodes.data() + offsets[variable_index], nodes.data() + offsets[variable_index + 1] };
+    }
+    size_t size() const { return offsets.size() - 1; }
+};
 
 namespace {
 
 /**
- * Compute all CyclicPermutations of the circuit. Each CyclicPermutation represents the indices of the values in the
- * witness wires that must have the same value.
+ * Compute all copy cycles of the circuit. Each cycle represents the indices of the values in the witness wires that
+ * must have the same value.
+ *
+ * @details The wire slots are bucketed by the real variable they hold with a stable counting sort. The slots are split
+ * into one contiguous range per thread, and each thread counts the slots of each variable in its range. An exclusive
+ * prefix sum over (variable, thread) gives every thread its own places in every bucket, so each thread writes its
+ * slots without atomics, and every cycle lists its nodes in slot order, i.e. by (gate, wire).
  *
  * @tparam program_width Program width
  * */
 template <size_t program_width, typename CircuitConstructor>
-std::vector<CyclicPermutation> compute_wire_copy_cycles(const CircuitConstructor& circuit_constructor)
+WireCopyCycles compute_wire_copy_cycles(const CircuitConstructor& circuit_constructor)
 {
     // Reference circuit constructor members
     const size_t num_gates = circuit_constructor.num_gates;
@@ -84,7 +108,6 @@ std::vector<CyclicPermutation> compute_wire_copy_cycles(const CircuitConstructor
 
     // Each variable represents one cycle
     const size_t number_of_cycles = circuit_constructor.variables.size();
-    std::vector<CyclicPermutation> copy_cycles(number_of_cycles);
 
     // Represents the index of a variable in circuit_constructor.variables
     std::span<const uint32_t> real_variable_index = circuit_constructor.real_variable_index;
@@ -99,28 +122,76 @@ std::vector<CyclicPermutation> compute_wire_copy_cycles(const CircuitConstructor
     //   (i) -> (n+i) -> (i') -> ... -> (i'')
     // (Using the convention that W^L_i = W_i and W^R_i = W_{n+i}, W^O_i = W_{2n+i})
     //
-    // This loop initializes the i-th cycle with (i) -> (n+i), meaning that we always expect W^L_i = W^R_i,
-    // for all i s.t. row i defines a public input.
-    for (size_t i = 0; i < num_public_inputs; ++i) {
-        const uint32_t public_input_index = real_variable_index[public_inputs[i]];
-        const auto gate_index = static_cast<uint32_t>(i);
-        // These two nodes must be in adjacent locations in the cycle for correct handling of public inputs
-        copy_cycles[public_input_index].emplace_back(cycle_node{ 0, gate_index });
-        copy_cycles[public_input_index].emplace_back(cycle_node{ 1, gate_index });
+    // So the slots are, in order: the LEFT and RIGHT wires of each public input row, meaning that we always expect
+    // W^L_i = W^R_i for all i s.t. row i defines a public input, followed by every wire of each of the "real" gates.
+    // Ordering slots by (gate, wire) is the same as ordering them by slot index.
+    const size_t num_public_input_slots = 2 * num_public_inputs;
+    const size_t num_slots = num_public_input_slots + program_width * num_gates;
+    // Returns the slot's node and the index of the (real) variable it holds.
+    auto get_slot = [&](const size_t slot) {
+        if (slot < num_public_input_slots) {
+            const size_t i = slot >> 1;
+            return std::make_pair(cycle_node{ static_cast<uint32_t>(slot & 1), static_cast<uint32_t>(i) },
+                                  real_variable_index[public_inputs[i]]);
+        }
+        // We are looking at the j-th wire in the i-th row.
+        // The value in this position should be equal to the value of the element at index `var_index`
+        // of the `constructor.variables` vector.
+        const size_t i = (slot - num_public_input_slots) / program_width;
+        const size_t j = (slot - num_public_input_slots) % program_width;
+        return std::make_pair(cycle_node{ static_cast<uint32_t>(j), static_cast<uint32_t>(i + num_public_inputs) },
+                              real_variable_index[wire_indices[j][i]]);
+    };
+
+    // Each thread counts the slots of its own range in its own histogram, so no counts are shared between threads.
+    // The histograms take 4 bytes per variable per thread; the number of threads is capped so that they take at most
+    // four times the space of the nodes they are sorting (8 bytes per slot).
+    const size_t max_num_threads = (8 * num_slots) / std::max<size_t>(number_of_cycles, 1);
+    const size_t num_threads =
+        std::max<size_t>(1, std::min(max_threads::compute_num_threads_unrounded(), max_num_threads));
+    std::vector<uint32_t> histograms(num_threads * number_of_cycles, 0);
+#ifndef NO_MULTITHREADING
+#pragma omp parallel for
+#endif
+    for (size_t thread = 0; thread < num_threads; ++thread) {
+        const auto range = max_threads::get_thread_range(num_slots, num_threads, thread);
+        uint32_t* histogram = &histograms[thread * number_of_cycles];
+        for (size_t slot = range.start; slot < range.end; ++slot) {
+            ++histogram[get_slot(slot).second];
+        }
     }
 
-    // Iterate over all variables of the "real" gates, and add a corresponding node to the cycle for that variable
-    for (size_t i = 0; i < num_gates; ++i) {
-        for (size_t j = 0; j < program_width; ++j) {
-            // We are looking at the j-th wire in the i-th row.
-            // The value in this position should be equal to the value of the element at index `var_index`
-            // of the `constructor.variables` vector.
-            // Therefore, we add (i,j) to the cycle at index `var_index` to indicate that w^j_i should have the values
-            // constructor.variables[var_index].
-            const uint32_t var_index = circuit_constructor.real_variable_index[wire_indices[j][i]];
-            const auto wire_index = static_cast<uint32_t>(j);
-            const auto gate_index = static_cast<uint32_t>(i + num_public_inputs);
-            copy_cycles[var_index].emplace_back(cycle_node{ wire_index, gate_index });
+    // Turn the counts into an exclusive prefix sum over (variable, thread): each thread's count of a variable becomes
+    // the position of its first slot within the variable's bucket, and the bucket sizes become the offsets.
+    WireCopyCycles copy_cycles;
+    copy_cycles.offsets.assign(number_of_cycles + 1, 0);
+    auto& offsets = copy_cycles.offsets;
+#ifndef NO_MULTITHREADING
+#pragma omp parallel for
+#endif
+    for (size_t i = 0; i < number_of_cycles; ++i) {
+        uint32_t bucket_size = 0;
+        for (size_t thread = 0; thread < num_threads; ++thread) {
+            const uint32_t count = histograms[thread * number_of_cycles + i];
+            histograms[thread * number_of_cycles + i] = bucket_size;
+            bucket_size += count;
+        }
+        offsets[i + 1] = bucket_size;
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    // Each thread writes its slots to the places it was given. The threads' ranges are in slot order, and each thread
+    // writes its own slots in order, so every bucket lists its slots in slot order.
+    copy_cycles.nodes.resize(num_slots);
+#ifndef NO_MULTITHREADING
+#pragma omp parallel for
+#endif
+    for (size_t thread = 0; thread < num_threads; ++thread) {
+        const auto range = max_threads::get_thread_range(num_slots, num_threads, thread);
+        uint32_t* next_free = &histograms[thread * number_of_cycles];
+        for (size_t slot = range.start; slot < range.end; ++slot) {
+            const auto [node, var_index] = get_slot(slot);
+            copy_cycles.nodes[offsets[var_index] + next_free[var_index]++] = node;
         }
     }
     return copy_cycles;
@@ -132,6 +203,8 @@ std::vector<CyclicPermutation> compute_wire_copy_cycles(const CircuitConstructor
  * @details Computes the mappings from which the sigma polynomials (and conditionally, the id polynomials)
  * can be computed. The output is proving system agnostic.
  *
+ * Cycles are disjoint, so each one is written into the mapping independently, in parallel.
+ *
  * @tparam program_width The number of wires
  * @tparam generalized (bool) Triggers use of gen perm tags and computation of id mappings when true
  * @tparam CircuitConstructor The class that holds basic circuitl ogic
@@ -150,17 +223,23 @@ PermutationMapping<program_width> compute_permutation_mapping(const CircuitConst
 
     // Initialize the table of permutations so that every element points to itself
     for (size_t i = 0; i < program_width; ++i) {
-        mapping.sigmas[i].reserve(key->circuit_size);
+        mapping.sigmas[i].resize(key->circuit_size);
         if (generalized) {
-            mapping.ids[i].reserve(key->circuit_size);
+            mapping.ids[i].resize(key->circuit_size);
         }
-
-        for (size_t j = 0; j < key->circuit_size; ++j) {
-            mapping.sigmas[i].emplace_back(permutation_subgroup_element{
-                .row_index = (uint32_t)j, .column_index = (uint8_t)i, .is_public_input = false, .is_tag = false });
+    }
+#ifndef NO_MULTITHREADING
+#pragma omp parallel for
+#endif
+    for (size_t j = 0; j < key->circuit_size; ++j) {
+        for (size_t i = 0; i < program_width; ++i) {
+            mapping.sigmas[i][j] = permutation_subgroup_element{
+                .row_index = (uint32_t)j, .column_index = (uint8_t)i, .is_public_input = false, .is_tag = false
+            };
             if (generalized) {
-                mapping.ids[i].emplace_back(permutation_subgroup_element{
-                    .row_index = (uint32_t)j, .column_index = (uint8_t)i, .is_public_input = false, .is_tag = false });
+                mapping.ids[i][j] = permutation_subgroup_element{
+                    .row_index = (uint32_t)j, .column_index = (uint8_t)i, .is_public_input = false, .is_tag = false
+                };
             }
         }
     }
@@ -169,8 +248,11 @@ PermutationMapping<program_width> compute_permutation_mapping(const CircuitConst
     std::span<const uint32_t> real_variable_tags = circuit_constructor.real_variable_tags;
 
     // Go through each cycle
-    size_t cycle_index = 0;
-    for (auto& copy_cycle : wire_copy_cycles) {
+#ifndef NO_MULTITHREADING
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for (size_t cycle_index = 0; cycle_index < wire_copy_cycles.size(); ++cycle_index) {
+        const auto copy_cycle = wire_copy_cycles[cycle_index];
         for (size_t node_idx = 0; node_idx < copy_cycle.size(); ++node_idx) {
             // Get the indices of the current node and next node in the cycle
             cycle_node current_cycle_node = copy_cycle[node_idx];
@@ -204,7 +286,6 @@ PermutationMapping<program_width> compute_permutation_mapping(const CircuitConst
                 }
             }
         }
-        cycle_index++;
     }
 
     // Add information about public inputs to the computation
@@ -249,9 +330,9 @@ void compute_honk_style_permutation_lagrange_polynomials_from_mapping(
         if (current_mapping.is_public_input) {
             // We intentionally want to break the cycles of the public input variables.
             // During the witness generation, the left and right wire polynomials at index i contain the i-th public
-            // input. The CyclicPermutation created for these variables always start with (i) -> (n+i), followed by
-            // the indices of the variables in the "real" gates. We make i point to -(i+1), so that the only way of
-            // repairing the cycle is add the mapping
+            // input. The bucket of each of these variables in WireCopyCycles always starts with (i) -> (n+i),
+            // followed by the indices of the variables in the "real" gates. We make i point to -(i+1), so that the
+            // only way of repairing the cycle is add the mapping
             //  -(i+1) -> (n+i)
             // These indices are chosen so they can easily be computed by the verifier. They can expect the running
             // product to be equal to the "public input delta" that is computed in <honk/utils/grand_product_delta.hpp>
@@ -0,0 +1,156 @@
+#include "permutation_helper.hpp"
+#include "barretenberg/proof_system/circuit_constructors/standard_circuit_constructor.hpp"
+#include "barretenberg/proof_system/circuit_constructors/ultra_circuit_constructor.hpp"
+#include <gtest/gtest.h>
+#ifndef NO_MULTITHREADING
+#include <omp.h>
+#endif
+
+using namespace barretenberg;
+using namespace proof_system;
+
+namespace {
+auto& engine = numeric::random::get_debug_engine();
+
+// The copy cycles built one push at a time, in slot order.
+template <size_t program_width, typename CircuitConstructor>
+std::vector<std::vector<cycle_node>> compute_expected_cycles(const CircuitConstructor& circuit_constructor)
+{
+    const auto& real_variable_index = circuit_constructor.real_variable_index;
+    const size_t num_public_inputs = circuit_constructor.public_inputs.size();
+    std::vector<std::vector<cycle_node>> cycles(circuit_constructor.variables.size());
+    for (size_t i = 0; i < num_public_inputs; ++i) {
+        auto& cycle = cycles[real_variable_index[circuit_constructor.public_inputs[i]]];
+        cycle.push_back({ 0, static_cast<uint32_t>(i) });
+        cycle.push_back({ 1, static_cast<uint32_t>(i) });
+    }
+    for (size_t i = 0; i < circuit_constructor.num_gates; ++i) {
+        for (size_t j = 0; j < program_width; ++j) {
+            const uint32_t var_index = real_variable_index[circuit_constructor.wires[j][i]];
+            cycles[var_index].push_back({ static_cast<uint32_t>(j), static_cast<uint32_t>(i + num_public_inputs) });
+        }
+    }
+    return cycles;
+}
+
+template <size_t program_width, typename CircuitConstructor>
+void check_wire_copy_cycles(const CircuitConstructor& circuit_constructor)
+{
+    const auto expected = compute_expected_cycles<program_width>(circuit_constructor);
+    const auto cycles = compute_wire_copy_cycles<program_width>(circuit_constructor);
+    ASSERT_EQ(cycles.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_EQ(cycles[i].size(), expected[i].size());
+        for (size_t j = 0; j < expected[i].size(); ++j) {
+            EXPECT_EQ(cycles[i][j].wire_index, expected[i][j].wire_index);
+            EXPECT_EQ(cycles[i][j].gate_index, expected[i][j].gate_index);
+        }
+    }
+}
+
+// Checks that the mapping sends each slot of a cycle to the next one, and the last one back to the first.
+template <size_t program_width, bool generalized, typename CircuitConstructor>
+void check_permutation_mapping(const CircuitConstructor& circuit_constructor,
+                               const size_t circuit_size,
+                               const ComposerType type)
+{
+    plonk::proving_key key(circuit_size, circuit_constructor.public_inputs.size(), nullptr, type);
+    const auto mapping = compute_permutation_mapping<program_width, generalized>(circuit_constructor, &key);
+    const auto cycles = compute_expected_cycles<program_width>(circuit_constructor);
+    const size_t num_public_inputs = circuit_constructor.public_inputs.size();
+
+    std::array<std::vector<bool>, program_width> visited;
+    for (auto& column : visited) {
+        column.resize(circuit_size, false);
+    }
+    for (size_t i = 0; i < cycles.size(); ++i) {
+        for (size_t j = 0; j < cycles[i].size(); ++j) {
+            const auto node = cycles[i][j];
+            const auto next = cycles[i][(j + 1) % cycles[i].size()];
+            const auto& sigma = mapping.sigmas[node.wire_index][node.gate_index];
+            visited[node.wire_index][node.gate_index] = true;
+            if (node.wire_index == 0 && node.gate_index < num_public_inputs) {
+                EXPECT_TRUE(sigma.is_public_input);
+            } else if (generalized && j == cycles[i].size() - 1) {
+                EXPECT_TRUE(sigma.is_tag);
+                EXPECT_EQ(sigma.row_index, circuit_constructor.tau.at(circuit_constructor.real_variable_tags[i]));
+            } else {
+                EXPECT_FALSE(sigma.is_tag);
+                EXPECT_EQ(sigma.row_index, next.gate_index);
+                EXPECT_EQ(sigma.column_index, next.wire_index);
+            }
+            if (generalized) {
+                const auto& id = mapping.ids[node.wire_index][node.gate_index];
+                EXPECT_EQ(id.is_tag, j == 0);
+                EXPECT_EQ(id.row_index, j == 0 ? circuit_constructor.real_variable_tags[i] : node.gate_index);
+            }
+        }
+    }
+    // Slots outside of the circuit point to themselves.
+    for (size_t j = 0; j < program_width; ++j) {
+        for (size_t i = 0; i < circuit_size; ++i) {
+            if (!visited[j][i]) {
+                EXPECT_EQ(mapping.sigmas[j][i].row_index, i);
+                EXPECT_EQ(mapping.sigmas[j][i].column_index, j);
+            }
+        }
+    }
+}
+} // namespace
+
+TEST(permutation_helper, standard_wire_copy_cycles)
+{
+    StandardCircuitConstructor circuit_constructor;
+    std::vector<uint32_t> indices;
+    for (size_t i = 0; i < 16; ++i) {
+        indices.push_back(circuit_constructor.add_public_variable(fr(i)));
+    }
+    for (size_t i = 0; i < 1000; ++i) {
+        const uint32_t a_idx = indices[engine.get_random_uint32() % indices.size()];
+        const uint32_t b_idx = indices[engine.get_random_uint32() % indices.size()];
+        const fr c = circuit_constructor.get_variable(a_idx) + circuit_constructor.get_variable(b_idx);
+        const uint32_t c_idx = circuit_constructor.add_variable(c);
+        circuit_constructor.create_add_gate({ a_idx, b_idx, c_idx, 1, 1, -1, 0 });
+        indices.push_back(c_idx);
+        // Join some of the sums up with copies of themselves.
+        if (i % 3 == 0) {
+            const uint32_t copy_idx = circuit_constructor.add_variable(c);
+            circuit_constructor.assert_equal(copy_idx, c_idx);
+            indices.push_back(copy_idx);
+        }
+    }
+    EXPECT_TRUE(circuit_constructor.check_circuit());
+
+    check_wire_copy_cycles<3>(circuit_constructor);
+    check_permutation_mapping<3, false>(circuit_constructor, 2048, ComposerType::STANDARD);
+
+#ifndef NO_MULTITHREADING
+    // Each thread gets its own places in every cycle, so the cycles do not depend on the number of threads.
+    const int max_threads = omp_get_max_threads();
+    for (const int num_threads : { 2, 3, 8 }) {
+        omp_set_num_threads(num_threads);
+        check_wire_copy_cycles<3>(circuit_constructor);
+    }
+    omp_set_num_threads(max_threads);
+#endif
+}
+
+TEST(permutation_helper, ultra_generalized_permutation_mapping)
+{
+    UltraCircuitConstructor circuit_constructor;
+    circuit_constructor.add_public_variable(fr(5));
+    for (size_t i = 0; i < 200; ++i) {
+        const uint32_t idx = circuit_constructor.add_variable(fr(engine.get_random_uint8()));
+        circuit_constructor.create_new_range_constraint(idx, i % 2 == 0 ? 255 : 1000);
+        // Copies of a range constrained variable share its tag.
+        if (i % 3 == 0) {
+            const uint32_t copy_idx = circuit_constructor.add_variable(circuit_constructor.get_variable(idx));
+            circuit_constructor.assert_equal(copy_idx, idx);
+            circuit_constructor.create_add_gate({ copy_idx, idx, circuit_constructor.zero_idx, 1, -1, 0, 0 });
+        }
+    }
+    circuit_constructor.finalize_circuit();
+
+    check_wire_copy_cycles<4>(circuit_constructor);
+    check_permutation_mapping<4, true>(circuit_constructor, 2048, ComposerType::PLOOKUP);
+}
@@ -3,6 +3,8 @@
 #include "barretenberg/ecc/curves/bn254/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
 
+#include <algorithm>
+
 namespace proof_system::plonk {
 
 work_queue::work_queue(proving_key* prover_key, transcript::StandardTranscript* prover_transcript)
@@ -192,28 +194,87 @@ void work_queue::add_to_queue(const work_item& item)
 #endif
 }
 
-void work_queue::process_queue()
+void work_queue::process_scalar_multiplications()
 {
+    std::vector<barretenberg::fr*> scalars;
+    std::vector<size_t> msm_sizes;
+    std::vector<const work_item*> items;
+    size_t max_msm_size = 0;
     for (const auto& item : work_item_queue) {
-        switch (item.work_type) {
-        // most expensive op
-        case WorkType::SCALAR_MULTIPLICATION: {
+        if (item.work_type == WorkType::SCALAR_MULTIPLICATION) {
             // Note: work_item.constant is an Fr type (see SMALL_FFT), but here it is interpreted simply as a size_t
             auto msm_size = static_cast<size_t>(static_cast<uint256_t>(item.constant));
 
             ASSERT(msm_size <= key->reference_string->get_monomial_size());
 
-            barretenberg::g1::affine_element* srs_points = key->reference_string->get_monomial_points();
+            scalars.push_back(item.mul_scalars);
+            msm_sizes.push_back(msm_size);
+            items.push_back(&item);
+            max_msm_size = std::max(max_msm_size, msm_size);
+        }
+    }
+    if (items.empty()) {
+        return;
+    }
 
-            // Run pippenger multi-scalar multiplication.
-            auto runtime_state = barretenberg::scalar_multiplication::pippenger_runtime_state(msm_size);
-            barretenberg::g1::affine_element result(barretenberg::scalar_multiplication::pippenger_unsafe(
-                item.mul_scalars, srs_points, msm_size, runtime_state));
+    barretenberg::g1::affine_element* srs_points = key->reference_string->get_monomial_points();
 
-            transcript->add_element(item.tag, result.to_buffer());
+    // Run every pippenger multi-scalar multiplication of the round against one runtime state. The multiplications
+    // still run one after the other (see `pippenger_batch`).
+    auto runtime_state = barretenberg::scalar_multiplication::pippenger_runtime_state(max_msm_size);
+    std::vector<barretenberg::g1::element> results =
+        barretenberg::scalar_multiplication::pippenger_batch(scalars, msm_sizes, srs_points, runtime_state);
 
-            break;
+    // Commitments are added to the transcript in queue order.
+    for (size_t i = 0; i < items.size(); ++i) {
+        barretenberg::g1::affine_element result(results[i]);
+        transcript->add_element(items[i]->tag, result.to_buffer());
+    }
+}
+
+void work_queue::process_ffts()
+{
+    using namespace barretenberg;
+    std::vector<const work_item*> items;
+    for (const auto& item : work_item_queue) {
+        if (item.work_type == WorkType::FFT) {
+            items.push_back(&item);
         }
+    }
+    if (items.empty()) {
+        return;
+    }
+
+    const size_t n = key->circuit_size;
+    std::vector<polynomial> wire_ffts;
+    std::vector<fr*> wire_fft_data;
+    wire_ffts.reserve(items.size());
+    for (const auto* item : items) {
+        polynomial& wire = key->polynomial_store.get(item->tag);
+        wire_ffts.emplace_back(wire, 4 * n + 4);
+        wire_fft_data.push_back(wire_ffts.back().get_coefficients());
+    }
+
+    // All coset FFTs of the round share each pass over the large domain's root tables.
+    polynomial_arithmetic::coset_fft_batch(wire_fft_data, key->large_domain);
+
+    for (size_t j = 0; j < items.size(); ++j) {
+        for (size_t i = 0; i < 4; i++) {
+            wire_ffts[j][4 * n + i] = wire_ffts[j][i];
+        }
+        key->polynomial_store.put(items[j]->tag + "_fft", std::move(wire_ffts[j]));
+    }
+}
+
+void work_queue::process_queue()
+{
+    // most expensive op
+    process_scalar_multiplications();
+
+    process_ffts();
+
+    for (const auto& item : work_item_queue) {
+        switch (item.work_type) {
         // About 20% of the cost of a scalar multiplication. For WASM, might be a bit more expensive
         // due to the need to copy memory between web workers
         case WorkType::SMALL_FFT: {
@@ -239,20 +300,6 @@ void work_queue::process_queue()
             }
             break;
         }
-        case WorkType::FFT: {
-            using namespace barretenberg;
-            polynomial& wire = key->polynomial_store.get(item.tag);
-            polynomial wire_fft(wire, 4 * key->circuit_size + 4);
-
-            wire_fft.coset_fft(key->large_domain);
-            for (size_t i = 0; i < 4; i++) {
-                wire_fft[4 * key->circuit_size + i] = wire_fft[i];
-            }
-
-            key->polynomial_store.put(item.tag + "_fft", std::move(wire_fft));
-
-            break;
-        }
         // 1/4 the cost of an fft (each fft has 1/4 the number of elements)
         case WorkType::IFFT: {
             using namespace barretenberg;
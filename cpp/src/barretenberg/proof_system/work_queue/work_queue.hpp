@@ -61,6 +61,10 @@ class work_queue {
     std::vector<work_item> get_queue() const;
 
   private:
+    void process_scalar_multiplications();
+
+    void process_ffts();
+
     proving_key* key;
     transcript::StandardTranscript* transcript;
     std::vector<work_item> work_item_queue;
@@ -2,6 +2,7 @@
 #include "barretenberg/common/mem.hpp"
 #include "barretenberg/common/net.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
+#include <atomic>
 #include <fstream>
 #include <sys/stat.h>
 
@@ -137,8 +138,9 @@ bool is_file_exist(std::string const& fileName)
     return infile.good();
 }
 
-void read_transcript_g1(g1::affine_element* monomials, size_t degree, std::string const& dir)
+std::vector<TranscriptChunk> get_transcript_g1_chunks(size_t degree, std::string const& dir)
 {
+    std::vector<TranscriptChunk> chunks;
     size_t num = 0;
     size_t num_read = 0;
     std::string path = get_transcript_path(dir, num);
@@ -147,17 +149,13 @@ void read_transcript_g1(g1::affine_element* monomials, size_t degree, std::strin
         Manifest manifest;
         read_manifest(path, manifest);
 
-        auto offset = sizeof(Manifest);
         const size_t num_to_read = std::min((size_t)manifest.num_g1_points, degree - num_read);
-        const size_t g1_buffer_size = sizeof(fq) * 2 * num_to_read;
-
-        char* buffer = (char*)&monomials[num_read];
-        size_t size = 0;
-
-        // We must pass the size actually read to the second call, not the desired
-        // g1_buffer_size as the file may have been smaller than this.
-        read_file_into_buffer(buffer, size, path, offset, g1_buffer_size);
-        byteswap(&monomials[num_read], size);
+        for (size_t i = 0; i < num_to_read; i += TRANSCRIPT_CHUNK_SIZE) {
+            chunks.push_back({ path,
+                               sizeof(Manifest) + sizeof(fq) * 2 * i,
+                               num_read + i,
+                               std::min(TRANSCRIPT_CHUNK_SIZE, num_to_read - i) });
+        }
 
         num_read += num_to_read;
         path = get_transcript_path(dir, ++num);
@@ -176,6 +174,43 @@ void read_transcript_g1(g1::affine_element* monomials, size_t degree, std::strin
                               "by editing `srs_db/download_ignition.sh` (but be careful, as this suggests you've "
                               "just changed a circuit to exceed a new 'power of two' boundary)."));
     }
+    return chunks;
+}
+
+bool read_transcript_g1_chunk(g1::affine_element* points, TranscriptChunk const& chunk)
+{
+    const size_t size = sizeof(fq) * 2 * chunk.num_points;
+    std::ifstream file(chunk.path, std::ifstream::binary);
+    file.seekg((std::streamoff)chunk.offset);
+    file.read((char*)points, (std::streamsize)size);
+    if (!file) {
+        return false;
+    }
+    byteswap(points, size);
+    return true;
+}
+
+void read_transcript_g1(g1::affine_element* monomials, size_t degree, std::string const& dir)
+{
+    const auto chunks = get_transcript_g1_chunks(degree, dir);
+
+    // Chunks are independent, so read and convert them on all threads. Errors are collected rather than thrown, as an
+    // exception must not escape the parallel region.
+    std::atomic<size_t> failed_chunk = chunks.size();
+#ifndef NO_MULTITHREADING
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+    for (size_t i = 0; i < chunks.size(); ++i) {
+        if (!read_transcript_g1_chunk(&monomials[chunks[i].start], chunks[i])) {
+            failed_chunk = i;
+        }
+    }
+
+    if (failed_chunk < chunks.size()) {
+        const auto& chunk = chunks[failed_chunk];
+        throw_or_abort(
+            format("Unable to read ", chunk.num_points, " points at offset ", chunk.offset, " of ", chunk.path, "."));
+    }
 }
 
 void read_transcript_g2(g2::affine_element& g2_x, std::string const& dir)
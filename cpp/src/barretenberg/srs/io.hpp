@@ -3,6 +3,7 @@
 #include "../ecc/curves/bn254/g2.hpp"
 #include <cstdint>
 #include <string>
+#include <vector>
 
 namespace barretenberg {
 namespace io {
@@ -17,6 +18,31 @@ struct Manifest {
     uint32_t start_from;
 };
 
+/**
+ * A run of consecutive g1 points of a transcript: points [start, start + num_points) of the SRS, stored at byte
+ * `offset` of the transcript file at `path`.
+ */
+struct TranscriptChunk {
+    std::string path;
+    size_t offset;
+    size_t start;
+    size_t num_points;
+};
+
+constexpr size_t TRANSCRIPT_CHUNK_SIZE = 1UL << 16;
+
+/**
+ * Split the first `degree` g1 points of the transcript in `dir` into chunks of at most TRANSCRIPT_CHUNK_SIZE points,
+ * in order. Only the manifests are read. Throws if the transcript holds fewer than `degree` points.
+ */
+std::vector<TranscriptChunk> get_transcript_g1_chunks(size_t degree, std::string const& dir);
+
+/**
+ * Read the points of `chunk` into `points` and convert them to Montgomery form. Returns false if the file could not be
+ * read in full. Chunks are independent, so they can be read concurrently.
+ */
+bool read_transcript_g1_chunk(g1::affine_element* points, TranscriptChunk const& chunk);
+
 void read_transcript_g1(g1::affine_element* monomials, size_t degree, std::string const& dir);
 
 void read_transcript_g2(g2::affine_element& g2_x, std::string const& dir);
@@ -3,6 +3,7 @@
  */
 #pragma once
 #include "reference_string.hpp"
+#include "streaming_point_table.hpp"
 
 #include "barretenberg/ecc/curves/bn254/g1.hpp"
 #include "barretenberg/ecc/curves/bn254/g2.hpp"
@@ -49,16 +50,32 @@ class FileReferenceString : public ProverReferenceString {
     scalar_multiplication::Pippenger pippenger_;
 };
 
+/**
+ * If `max_degree` is given, the first `max_degree` points start loading in the background on construction (see
+ * `StreamingPointTable`). Prover reference strings of up to `max_degree` points then share that table, and each waits
+ * only for its own points: a small circuit can be proven as soon as the start of the SRS has loaded.
+ */
 class FileReferenceStringFactory : public ReferenceStringFactory {
   public:
-    FileReferenceStringFactory(std::string path)
+    FileReferenceStringFactory(std::string path, [[maybe_unused]] const size_t max_degree = 0)
         : path_(std::move(path))
-    {}
+    {
+#ifndef __wasm__
+        if (max_degree > 0) {
+            point_table_ = std::make_shared<StreamingPointTable>(path_, max_degree);
+        }
+#endif
+    }
 
     FileReferenceStringFactory(FileReferenceStringFactory&& other) = default;
 
     std::shared_ptr<ProverReferenceString> get_prover_crs(size_t degree) override
     {
+#ifndef __wasm__
+        if (point_table_ && degree <= point_table_->get_num_points()) {
+            return std::make_shared<StreamingFileReferenceString>(point_table_, degree);
+        }
+#endif
         return std::make_shared<FileReferenceString>(degree, path_);
     }
 
@@ -69,6 +86,9 @@ class FileReferenceStringFactory : public ReferenceStringFactory {
 
   private:
     std::string path_;
+#ifndef __wasm__
+    std::shared_ptr<StreamingPointTable> point_table_;
+#endif
 };
 
 class DynamicFileReferenceStringFactory : public ReferenceStringFactory {
@@ -0,0 +1,108 @@
+#ifndef __wasm__
+#include "streaming_point_table.hpp"
+
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/ecc/curves/bn254/scalar_multiplication/pippenger.hpp"
+#include "barretenberg/ecc/curves/bn254/scalar_multiplication/point_table_cache.hpp"
+
+#include <algorithm>
+
+namespace proof_system {
+
+StreamingPointTable::StreamingPointTable(std::string const& path, const size_t num_points)
+    : num_points_(num_points)
+{
+    point_table_ = scalar_multiplication::map_point_table_cache(
+        scalar_multiplication::get_point_table_cache_path(path), num_points, mapped_size_);
+    if (point_table_ != nullptr) {
+        num_points_ready_ = num_points;
+        return;
+    }
+
+    // Read the manifests up front, so that a transcript that is too small is reported to the caller.
+    auto chunks = io::get_transcript_g1_chunks(num_points, path);
+    point_table_ = scalar_multiplication::point_table_alloc<g1::affine_element>(num_points);
+    loader_ = std::thread([this, chunks = std::move(chunks)]() { load(chunks); });
+}
+
+StreamingPointTable::~StreamingPointTable()
+{
+    stop_ = true;
+    if (loader_.joinable()) {
+        loader_.join();
+    }
+    if (mapped_size_ != 0) {
+        scalar_multiplication::unmap_point_table_cache(point_table_, mapped_size_);
+        return;
+    }
+    aligned_free(point_table_);
+}
+
+void StreamingPointTable::load(std::vector<io::TranscriptChunk> const& chunks)
+{
+    // Dynamic scheduling hands the chunks out in order, so the watermark advances steadily instead of waiting on
+    // whichever thread drew the first chunks.
+#ifndef NO_MULTITHREADING
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+    for (size_t i = 0; i < chunks.size(); ++i) {
+        if (stop_) {
+            continue;
+        }
+        const auto& chunk = chunks[i];
+        // Read the chunk into the front of its own table range and expand it in place. The ranges of different
+        // chunks do not overlap.
+        g1::affine_element* table = point_table_ + 2 * chunk.start;
+        if (!io::read_transcript_g1_chunk(table, chunk)) {
+            size_t failed_start = failed_start_.load();
+            while (chunk.start < failed_start && !failed_start_.compare_exchange_weak(failed_start, chunk.start)) {
+            }
+            notify();
+            continue;
+        }
+        scalar_multiplication::generate_pippenger_point_table(table, table, chunk.num_points);
+        set_chunk_ready(chunk.start, chunk.start + chunk.num_points);
+    }
+}
+
+void StreamingPointTable::set_chunk_ready(const size_t start, const size_t end)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ready_chunks_[start] = end;
+        size_t num_points_ready = num_points_ready_.load(std::memory_order_relaxed);
+        for (auto it = ready_chunks_.begin(); it != ready_chunks_.end() && it->first == num_points_ready;) {
+            num_points_ready = it->second;
+            it = ready_chunks_.erase(it);
+        }
+        num_points_ready_.store(num_points_ready, std::memory_order_release);
+    }
+    notify();
+}
+
+void StreamingPointTable::notify()
+{
+    num_events_.fetch_add(1);
+    num_events_.notify_all();
+}
+
+g1::affine_element* StreamingPointTable::wait_for_points(const size_t num_points)
+{
+    if (num_points > num_points_) {
+        throw_or_abort(format("Requested ", num_points, " points from a point table of ", num_points_, " points."));
+    }
+    while (true) {
+        // Read the event count first, so that an event after the checks below ends the wait.
+        const uint32_t num_events = num_events_.load();
+        if (get_num_points_ready() >= num_points) {
+            return point_table_;
+        }
+        if (failed_start_.load() < num_points) {
+            throw_or_abort(format("Unable to load ", num_points, " points of the SRS."));
+        }
+        num_events_.wait(num_events);
+    }
+}
+
+} // namespace proof_system
+#endif
@@ -0,0 +1,94 @@
+/**
+ * Load the pippenger point table of an SRS in the background, so that reference strings for small circuits can be
+ * served before the whole SRS has loaded.
+ */
+#pragma once
+#ifndef __wasm__
+#include "reference_string.hpp"
+#include "../io.hpp"
+
+#include "barretenberg/ecc/curves/bn254/g1.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace proof_system {
+
+using namespace barretenberg;
+
+/**
+ * The point table (see `generate_pippenger_point_table`) of the first `num_points` points of the SRS in `path`.
+ *
+ * If the directory holds a point table cache it is mapped, and every point is ready on construction. Otherwise a
+ * background thread reads the transcript in chunks on all threads, expanding each chunk into the table as soon as it is
+ * read. `get_num_points_ready()` is a watermark: the first that many points are in the table, so a reference string of
+ * up to that many points can be used while the remaining chunks are still loading.
+ */
+class StreamingPointTable {
+  public:
+    StreamingPointTable(std::string const& path, size_t num_points);
+    ~StreamingPointTable();
+
+    StreamingPointTable(const StreamingPointTable& other) = delete;
+    StreamingPointTable& operator=(const StreamingPointTable& other) = delete;
+
+    size_t get_num_points() const { return num_points_; }
+
+    size_t get_num_points_ready() const { return num_points_ready_.load(std::memory_order_acquire); }
+
+    /**
+     * Block until the first `num_points` points are ready, then return the table. Throws if they fail to load.
+     */
+    g1::affine_element* wait_for_points(size_t num_points);
+
+  private:
+    void load(std::vector<io::TranscriptChunk> const& chunks);
+    void set_chunk_ready(size_t start, size_t end);
+    void notify();
+
+    size_t num_points_;
+    size_t mapped_size_ = 0;
+    g1::affine_element* point_table_;
+
+    std::atomic<size_t> num_points_ready_ = 0;
+    // The first point of the earliest chunk that failed to load, past which the watermark cannot advance.
+    std::atomic<size_t> failed_start_ = SIZE_MAX;
+    // Bumped (and waited on) whenever a chunk is loaded or fails.
+    std::atomic<uint32_t> num_events_ = 0;
+    std::atomic<bool> stop_ = false;
+    // Chunks that finished ahead of the watermark: start -> end.
+    std::map<size_t, size_t> ready_chunks_;
+    std::mutex mutex_;
+    std::thread loader_;
+};
+
+/**
+ * A prover reference string of the first `num_points` points of a shared `StreamingPointTable`. Construction waits
+ * for those points only.
+ */
+class StreamingFileReferenceString : public ProverReferenceString {
+  public:
+    StreamingFileReferenceString(std::shared_ptr<StreamingPointTable> point_table, const size_t num_points)
+        : num_points_(num_points)
+        , monomials_(point_table->wait_for_points(num_points))
+        , point_table_(std::move(point_table))
+    {}
+
+    g1::affine_element* get_monomial_points() override { return monomials_; }
+
+    size_t get_monomial_size() const override { return num_points_; }
+
+  private:
+    size_t num_points_;
+    g1::affine_element* monomials_;
+    std::shared_ptr<StreamingPointTable> point_table_;
+};
+
+} // namespace proof_system
+#endif
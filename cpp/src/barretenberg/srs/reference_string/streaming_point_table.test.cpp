@@ -0,0 +1,40 @@
+#include "file_reference_string.hpp"
+#include "streaming_point_table.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace proof_system;
+
+TEST(reference_string, streaming_point_table_matches_file_reference_string)
+{
+    constexpr size_t num_points = (1UL << 17) + 1000;
+    FileReferenceStringFactory factory("../srs_db/ignition", num_points);
+
+    for (const size_t degree : { 1UL, 1000UL, num_points }) {
+        auto crs = factory.get_prover_crs(degree);
+        FileReferenceString expected(degree, "../srs_db/ignition");
+        EXPECT_NE(std::dynamic_pointer_cast<StreamingFileReferenceString>(crs), nullptr);
+        ASSERT_EQ(crs->get_monomial_size(), degree);
+        for (size_t i = 0; i < 2 * degree; ++i) {
+            ASSERT_EQ(crs->get_monomial_points()[i], expected.get_monomial_points()[i]);
+        }
+    }
+
+    // Larger reference strings are read separately.
+    EXPECT_NE(std::dynamic_pointer_cast<FileReferenceString>(factory.get_prover_crs(num_points + 1)), nullptr);
+}
+
+TEST(reference_string, streaming_point_table_watermark)
+{
+    constexpr size_t num_points = 1UL << 18;
+    StreamingPointTable table("../srs_db/ignition", num_points);
+    EXPECT_LE(table.get_num_points_ready(), num_points);
+
+    const auto* points = table.wait_for_points(num_points / 2);
+    EXPECT_GE(table.get_num_points_ready(), num_points / 2);
+    EXPECT_EQ(points[0], g1::affine_one);
+
+    table.wait_for_points(num_points);
+    EXPECT_EQ(table.get_num_points_ready(), num_points);
+    EXPECT_THROW(table.wait_for_points(num_points + 1), std::runtime_error);
+}
@@ -0,0 +1,492 @@
+#ifndef __wasm__
+#include "file_store.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <random>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace proof_system::plonk {
+namespace stdlib {
+namespace merkle_tree {
+
+namespace {
+// A record is [type: 1 byte][key size: 1 byte][value size: 4 bytes][key][value].
+constexpr size_t RECORD_HEADER_SIZE = 6;
+// The checkpoints are a sector apart, so a torn write can only damage one of them.
+constexpr uint64_t CHECKPOINT_SLOT_SIZE = 512;
+
+std::string to_string(std::span<const uint8_t> input)
+{
+    return std::string((char*)input.data(), input.size());
+}
+
+// FNV-1a, used for the checksums and to place keys in the index file, so it must not change between versions.
+uint64_t fnv1a(uint8_t const* data, size_t size)
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ data[i]) * 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+uint64_t get_index_slot(std::span<const uint8_t> key, uint64_t num_slots)
+{
+    const uint64_t hash = fnv1a(key.data(), key.size());
+    return (hash ^ (hash >> 32)) & (num_slots - 1);
+}
+
+uint64_t random_store_id()
+{
+    std::random_device device;
+    return (static_cast<uint64_t>(device()) << 32) | device();
+}
+
+void write_all(int fd, uint8_t const* data, size_t size, uint64_t offset, std::string const& path)
+{
+    while (size > 0) {
+        ssize_t written = pwrite(fd, data, size, static_cast<off_t>(offset));
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw_or_abort("Failed to write to " + path + ": " + std::strerror(errno));
+        }
+        data += written;
+        size -= static_cast<size_t>(written);
+        offset += static_cast<uint64_t>(written);
+    }
+}
+} // namespace
+
+FileStore::FileStore(std::string const& path)
+    : path_(path)
+{
+    fd_ = open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd_ < 0) {
+        throw_or_abort("Unable to open " + path + ": " + std::strerror(errno));
+    }
+    struct stat st;
+    if (fstat(fd_, &st) != 0) {
+        throw_or_abort("Unable to stat " + path + ": " + std::strerror(errno));
+    }
+    auto file_size = static_cast<uint64_t>(st.st_size);
+
+    if (file_size < LOG_OFFSET) {
+        // A new store, or one whose creation never completed.
+        store_id_ = random_store_id();
+        if (ftruncate(fd_, static_cast<off_t>(LOG_OFFSET)) != 0) {
+            throw_or_abort("Unable to resize " + path + ": " + std::strerror(errno));
+        }
+        write_checkpoint(0, 0);
+        sync();
+        file_size = LOG_OFFSET;
+    } else {
+        // Use the latest checkpoint that is intact and refers to a log that is present.
+        bool found = false;
+        for (uint64_t slot = 0; slot < 2; ++slot) {
+            Checkpoint checkpoint;
+            auto read = pread(fd_, &checkpoint, sizeof(checkpoint), static_cast<off_t>(slot * CHECKPOINT_SLOT_SIZE));
+            if (read != static_cast<ssize_t>(sizeof(checkpoint)) || checkpoint.magic != MAGIC ||
+                checkpoint.version != VERSION || checkpoint.checksum != compute_checksum(checkpoint) ||
+                LOG_OFFSET + checkpoint.log_size > file_size) {
+                continue;
+            }
+            if (!found || checkpoint.sequence > sequence_) {
+                sequence_ = checkpoint.sequence;
+                log_size_ = checkpoint.log_size;
+                store_id_ = checkpoint.store_id;
+                found = true;
+            }
+        }
+        if (!found) {
+            throw_or_abort("No valid checkpoint in " + path);
+        }
+    }
+
+    map_file(file_size);
+    load_index();
+    replay_log();
+    write_index_if_due();
+}
+
+FileStore::~FileStore()
+{
+    unmap_index();
+    if (data_ != nullptr) {
+        munmap(data_, map_size_);
+    }
+    if (fd_ >= 0) {
+        close(fd_);
+    }
+}
+
+bool FileStore::put(std::span<const uint8_t> key, std::span<const uint8_t> value)
+{
+    if (key.size() > UINT8_MAX || value.size() > UINT32_MAX) {
+        throw_or_abort("FileStore key or value too large");
+    }
+    auto key_str = to_string(key);
+    puts_[key_str] = to_string(value);
+    deletes_.erase(key_str);
+    return true;
+}
+
+bool FileStore::del(std::span<const uint8_t> key)
+{
+    auto key_str = to_string(key);
+    puts_.erase(key_str);
+    deletes_.insert(key_str);
+    return true;
+}
+
+bool FileStore::get(std::span<const uint8_t> key, std::span<const uint8_t>& value) const
+{
+    auto key_str = to_string(key);
+    if (deletes_.find(key_str) != deletes_.end()) {
+        return false;
+    }
+    auto it = puts_.find(key_str);
+    if (it != puts_.end()) {
+        value = std::span<const uint8_t>((uint8_t const*)it->second.data(), it->second.size());
+        return true;
+    }
+    ValueRef ref;
+    if (!find_committed(key_str, ref)) {
+        return false;
+    }
+    value = std::span<const uint8_t>(data_ + ref.offset, ref.size);
+    return true;
+}
+
+bool FileStore::get(std::span<const uint8_t> key, std::vector<uint8_t>& value) const
+{
+    std::span<const uint8_t> result;
+    if (!get(key, result)) {
+        return false;
+    }
+    value.assign(result.begin(), result.end());
+    return true;
+}
+
+void FileStore::commit()
+{
+    const uint64_t log_end = LOG_OFFSET + log_size_;
+    std::vector<uint8_t> records;
+    std::vector<std::pair<std::string const*, ValueRef>> new_refs;
+    new_refs.reserve(puts_.size());
+
+    auto append_record = [&](uint8_t type, std::string const& key, std::string const& value) {
+        const auto value_size = static_cast<uint32_t>(value.size());
+        records.push_back(type);
+        records.push_back(static_cast<uint8_t>(key.size()));
+        records.insert(records.end(), (uint8_t const*)&value_size, (uint8_t const*)&value_size + sizeof(value_size));
+        records.insert(records.end(), key.begin(), key.end());
+        records.insert(records.end(), value.begin(), value.end());
+    };
+    for (auto const& [key, value] : puts_) {
+        append_record(PUT_RECORD, key, value);
+        new_refs.push_back({ &key, { log_end + records.size() - value.size(), static_cast<uint32_t>(value.size()) } });
+    }
+    std::vector<std::string const*> deleted_keys;
+    for (auto const& key : deletes_) {
+        // Only keys that are in the committed log need a record.
+        ValueRef ref;
+        if (find_committed(key, ref)) {
+            append_record(DELETE_RECORD, key, "");
+            deleted_keys.push_back(&key);
+        }
+    }
+
+    if (!records.empty()) {
+        // The records must be on disk before the checkpoint that includes them.
+        write_all(fd_, records.data(), records.size(), log_end, path_);
+        sync();
+        write_checkpoint(sequence_ + 1, log_size_ + records.size());
+        sync();
+        ++sequence_;
+        log_size_ += records.size();
+        map_file(LOG_OFFSET + log_size_);
+
+        for (auto const& [key, ref] : new_refs) {
+            tail_index_[*key] = ref;
+        }
+        for (auto const* key : deleted_keys) {
+            tail_index_[*key] = { 0, 0 };
+        }
+    }
+
+    puts_.clear();
+    deletes_.clear();
+    write_index_if_due();
+}
+
+void FileStore::rollback()
+{
+    puts_.clear();
+    deletes_.clear();
+}
+
+void FileStore::write_index()
+{
+    // Size the table for every key in the old index and the tail, at most half full.
+    uint64_t num_slots = MIN_INDEX_SLOTS;
+    while (num_slots < 2 * (index_num_entries_ + tail_index_.size())) {
+        num_slots *= 2;
+    }
+    const uint64_t file_size = INDEX_SLOTS_OFFSET + num_slots * sizeof(uint64_t);
+
+    const std::string index_path = path_ + ".index";
+    const std::string temp_path = index_path + ".tmp" + std::to_string(getpid());
+    int fd = open(temp_path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        throw_or_abort("Unable to open " + temp_path + ": " + std::strerror(errno));
+    }
+    // The file starts out zeroed, so every slot is empty.
+    void* mapping = MAP_FAILED;
+    if (ftruncate(fd, static_cast<off_t>(file_size)) == 0) {
+        mapping = mmap(nullptr, file_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    if (mapping == MAP_FAILED) {
+        close(fd);
+        std::remove(temp_path.c_str());
+        throw_or_abort("Unable to write " + temp_path + ": " + std::strerror(errno));
+    }
+    auto* slots = (uint64_t*)(static_cast<uint8_t*>(mapping) + INDEX_SLOTS_OFFSET);
+
+    uint64_t num_entries = 0;
+    auto insert = [&](std::span<const uint8_t> key, uint64_t record_offset) {
+        uint64_t slot = get_index_slot(key, num_slots);
+        while (slots[slot] != 0) {
+            slot = (slot + 1) & (num_slots - 1);
+        }
+        slots[slot] = record_offset;
+        ++num_entries;
+    };
+    for (auto const& [key, ref] : tail_index_) {
+        if (ref.offset != 0) {
+            insert(std::span((uint8_t const*)key.data(), key.size()), ref.offset - RECORD_HEADER_SIZE - key.size());
+        }
+    }
+    // Keys in the tail were put or deleted after the old index was written, so their entries there are stale.
+    const uint64_t index_end = LOG_OFFSET + index_log_size_;
+    auto const* old_slots = (uint64_t const*)(index_data_ + INDEX_SLOTS_OFFSET);
+    for (uint64_t i = 0; i < index_num_slots_; ++i) {
+        if (old_slots[i] == 0) {
+            continue;
+        }
+        const auto record = read_record(old_slots[i], index_end);
+        if (tail_index_.find(to_string(record.key)) == tail_index_.end()) {
+            insert(record.key, old_slots[i]);
+        }
+    }
+
+    IndexHeader header{ .magic = INDEX_MAGIC,
+                        .version = VERSION,
+                        .store_id = store_id_,
+                        .log_size = log_size_,
+                        .num_slots = num_slots,
+                        .num_entries = num_entries,
+                        .checksum = 0 };
+    header.checksum = compute_checksum(header);
+    std::memcpy(mapping, &header, sizeof(header));
+    // The index must be on disk before it replaces the old one.
+    const bool synced = msync(mapping, file_size, MS_SYNC) == 0;
+    munmap(mapping, file_size);
+    close(fd);
+    if (!synced || std::rename(temp_path.c_str(), index_path.c_str()) != 0) {
+        std::remove(temp_path.c_str());
+        throw_or_abort("Unable to write " + index_path + ": " + std::strerror(errno));
+    }
+
+    unmap_index();
+    load_index();
+    if (index_log_size_ != log_size_) {
+        throw_or_abort("Unable to read " + index_path + " after writing it");
+    }
+    tail_index_.clear();
+}
+
+void FileStore::write_index_if_due()
+{
+    // Rewriting the index costs time in its size, so let the log past it grow as large before rewriting it.
+    if (log_size_ - index_log_size_ >= std::max(MIN_INDEX_INTERVAL, index_num_slots_ * sizeof(uint64_t))) {
+        write_index();
+    }
+}
+
+uint64_t FileStore::compute_checksum(Checkpoint const& checkpoint)
+{
+    // Over every field but the checksum.
+    return fnv1a((uint8_t const*)&checkpoint, offsetof(Checkpoint, checksum));
+}
+
+uint64_t FileStore::compute_checksum(IndexHeader const& header)
+{
+    return fnv1a((uint8_t const*)&header, offsetof(IndexHeader, checksum));
+}
+
+void FileStore::write_checkpoint(uint64_t sequence, uint64_t log_size)
+{
+    Checkpoint checkpoint{ .magic = MAGIC,
+                           .version = VERSION,
+                           .sequence = sequence,
+                           .log_size = log_size,
+                           .store_id = store_id_,
+                           .checksum = 0 };
+    checkpoint.checksum = compute_checksum(checkpoint);
+    write_all(fd_, (uint8_t const*)&checkpoint, sizeof(checkpoint), (sequence & 1) * CHECKPOINT_SLOT_SIZE, path_);
+}
+
+FileStore::Record FileStore::read_record(uint64_t pos, uint64_t end) const
+{
+    if (pos < LOG_OFFSET || pos > end || end - pos < RECORD_HEADER_SIZE) {
+        throw_or_abort("Corrupt record in " + path_);
+    }
+    Record record;
+    record.type = data_[pos];
+    const uint8_t key_size = data_[pos + 1];
+    uint32_t value_size;
+    std::memcpy(&value_size, data_ + pos + 2, sizeof(value_size));
+    pos += RECORD_HEADER_SIZE;
+    if ((record.type != PUT_RECORD && record.type != DELETE_RECORD) || end - pos < uint64_t(key_size) + value_size) {
+        throw_or_abort("Corrupt record in " + path_);
+    }
+    record.key = std::span<const uint8_t>(data_ + pos, key_size);
+    record.value = { pos + key_size, value_size };
+    record.end = pos + key_size + value_size;
+    return record;
+}
+
+bool FileStore::find_committed(std::string const& key, ValueRef& ref) const
+{
+    auto it = tail_index_.find(key);
+    if (it != tail_index_.end()) {
+        ref = it->second;
+        return ref.offset != 0;
+    }
+    return find_in_index(std::span((uint8_t const*)key.data(), key.size()), ref);
+}
+
+bool FileStore::find_in_index(std::span<const uint8_t> key, ValueRef& ref) const
+{
+    if (index_num_slots_ == 0) {
+        return false;
+    }
+    const uint64_t index_end = LOG_OFFSET + index_log_size_;
+    auto const* slots = (uint64_t const*)(index_data_ + INDEX_SLOTS_OFFSET);
+    uint64_t slot = get_index_slot(key, index_num_slots_);
+    for (uint64_t i = 0; i < index_num_slots_; ++i, slot = (slot + 1) & (index_num_slots_ - 1)) {
+        if (slots[slot] == 0) {
+            return false;
+        }
+        const auto record = read_record(slots[slot], index_end);
+        if (record.key.size() == key.size() && std::equal(key.begin(), key.end(), record.key.begin())) {
+            if (record.type != PUT_RECORD) {
+                throw_or_abort("Corrupt index of " + path_);
+            }
+            ref = record.value;
+            return true;
+        }
+    }
+    return false;
+}
+
+void FileStore::load_index()
+{
+    const std::string index_path = path_ + ".index";
+    int fd = open(index_path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return;
+    }
+    struct stat st;
+    IndexHeader header;
+    const bool valid = fstat(fd, &st) == 0 && pread(fd, &header, sizeof(header), 0) == sizeof(header) &&
+                       header.magic == INDEX_MAGIC && header.version == VERSION &&
+                       header.checksum == compute_checksum(header) && header.store_id == store_id_ &&
+                       header.log_size <= log_size_ && header.num_slots >= MIN_INDEX_SLOTS &&
+                       (header.num_slots & (header.num_slots - 1)) == 0 &&
+                       header.num_entries < header.num_slots &&
+                       static_cast<uint64_t>(st.st_size) == INDEX_SLOTS_OFFSET + header.num_slots * sizeof(uint64_t);
+    if (!valid) {
+        // Written for another store, or ahead of a checkpoint that was lost: replay the whole log.
+        close(fd);
+        return;
+    }
+    const size_t map_size = static_cast<size_t>(st.st_size);
+    void* data = mmap(nullptr, map_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        throw_or_abort("Unable to map " + index_path + ": " + std::strerror(errno));
+    }
+    index_data_ = static_cast<uint8_t const*>(data);
+    index_map_size_ = map_size;
+    index_log_size_ = header.log_size;
+    index_num_slots_ = header.num_slots;
+    index_num_entries_ = header.num_entries;
+}
+
+void FileStore::unmap_index()
+{
+    if (index_data_ != nullptr) {
+        munmap((void*)index_data_, index_map_size_);
+    }
+    index_data_ = nullptr;
+    index_map_size_ = 0;
+    index_log_size_ = 0;
+    index_num_slots_ = 0;
+    index_num_entries_ = 0;
+}
+
+void FileStore::replay_log()
+{
+    const uint64_t end = LOG_OFFSET + log_size_;
+    uint64_t pos = LOG_OFFSET + index_log_size_;
+    while (pos < end) {
+        const auto record = read_record(pos, end);
+        tail_index_[to_string(record.key)] = record.type == PUT_RECORD ? record.value : ValueRef{ 0, 0 };
+        pos = record.end;
+    }
+}
+
+void FileStore::map_file(uint64_t file_size)
+{
+    if (file_size <= map_size_) {
+        return;
+    }
+
+    // Map more than the file holds, so that the mapping only changes when the log doubles. Only the committed log is
+    // ever read through it.
+    size_t map_size = std::max(map_size_, MIN_MAP_SIZE);
+    while (map_size < file_size) {
+        map_size *= 2;
+    }
+    if (data_ != nullptr) {
+        munmap(data_, map_size_);
+    }
+    void* data = mmap(nullptr, map_size, PROT_READ, MAP_SHARED, fd_, 0);
+    if (data == MAP_FAILED) {
+        throw_or_abort("Unable to map " + path_ + ": " + std::strerror(errno));
+    }
+    data_ = static_cast<uint8_t*>(data);
+    map_size_ = map_size;
+}
+
+void FileStore::sync()
+{
+    if (fsync(fd_) != 0) {
+        throw_or_abort("Unable to sync " + path_ + ": " + std::strerror(errno));
+    }
+}
+
+} // namespace merkle_tree
+} // namespace stdlib
+} // namespace proof_system::plonk
+#endif
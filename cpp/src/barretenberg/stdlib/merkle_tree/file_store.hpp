@@ -0,0 +1,158 @@
+#pragma once
+#include <cstdint>
+#include <map>
+#include <set>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace proof_system::plonk {
+namespace stdlib {
+namespace merkle_tree {
+
+/**
+ * A persistent key-value store for `MerkleTree`, backed by a single local file.
+ *
+ * Puts and deletes are staged in memory exactly as in `MemoryStore`, and become durable on `commit()`, or are
+ * discarded by `rollback()`. The file holds an append-only log of put and delete records, read through a shared memory
+ * mapping, preceded by two checkpoint slots:
+ *
+ *     [ checkpoint 0 | checkpoint 1 | ... ][ record ][ record ] ...
+ *      <--------- LOG_OFFSET bytes ------>
+ *
+ * A checkpoint holds a sequence number, the length of the committed log, an id chosen when the store is created and a
+ * checksum. `commit()` appends the staged records after the committed log and syncs them to disk, then writes the next
+ * checkpoint into the older slot and syncs it. Records past the length in the latest valid checkpoint are ignored, so a
+ * crash at any point leaves the store at the last commit. If the checkpoint write is torn, its checksum fails and the
+ * other slot is used.
+ *
+ * Keys are found through an index file, `<path>.index`: an open-addressing hash table from key to record offset,
+ * covering a prefix of the committed log, which is mapped rather than read. Only the log past that prefix is replayed
+ * on open, into an in-memory index, so reopening costs time in the number of records written since the index, not in
+ * the size of the store. `commit()` rewrites the index file once the log past it outgrows it, and `write_index()`
+ * rewrites it on demand, e.g. before shutting down. An index file that is missing, belongs to another store or covers
+ * more than the committed log is ignored, and the whole log is replayed. No hashing is redone on open.
+ *
+ * Deleted and overwritten values stay in the log; the log is never compacted, but they are dropped from the index.
+ *
+ * A span returned by `get` stays valid until the next `commit()` or `rollback()`.
+ */
+class FileStore {
+  public:
+    explicit FileStore(std::string const& path);
+    ~FileStore();
+
+    FileStore(FileStore const& rhs) = delete;
+    FileStore(FileStore&& rhs) = delete;
+    FileStore& operator=(FileStore const& rhs) = delete;
+    FileStore& operator=(FileStore&& rhs) = delete;
+
+    bool put(std::span<const uint8_t> key, std::span<const uint8_t> value);
+
+    bool del(std::span<const uint8_t> key);
+
+    bool get(std::span<const uint8_t> key, std::span<const uint8_t>& value) const;
+
+    bool get(std::span<const uint8_t> key, std::vector<uint8_t>& value) const;
+
+    void commit();
+
+    void rollback();
+
+    /**
+     * Writes the index of the committed log to `<path>.index`, so that the next open only replays the log committed
+     * after this call.
+     */
+    void write_index();
+
+    // The number of bytes of committed log.
+    uint64_t log_size() const { return log_size_; }
+
+    // The number of bytes of committed log covered by the index file. Opening the store replays the rest.
+    uint64_t index_log_size() const { return index_log_size_; }
+
+    static constexpr uint64_t LOG_OFFSET = 4096;
+
+  private:
+    struct Checkpoint {
+        uint64_t magic;
+        uint64_t version;
+        uint64_t sequence;
+        uint64_t log_size;
+        uint64_t store_id;
+        uint64_t checksum;
+    };
+
+    struct IndexHeader {
+        uint64_t magic;
+        uint64_t version;
+        uint64_t store_id;
+        // The length of the committed log that the index covers.
+        uint64_t log_size;
+        // A power of two. Each slot holds a record offset, or 0 if it is empty.
+        uint64_t num_slots;
+        uint64_t num_entries;
+        uint64_t checksum;
+    };
+
+    // The offset and size of a value in the log. An offset of 0 marks a key deleted since the index file was written.
+    struct ValueRef {
+        uint64_t offset;
+        uint32_t size;
+    };
+
+    struct Record {
+        uint8_t type;
+        std::span<const uint8_t> key;
+        ValueRef value;
+        uint64_t end;
+    };
+
+    static constexpr uint64_t MAGIC = 0x454c49464b4c524dULL; // "MRLKFILE"
+    static constexpr uint64_t INDEX_MAGIC = 0x58444e494b4c524dULL; // "MRLKINDX"
+    static constexpr uint64_t VERSION = 2;
+    static constexpr uint8_t PUT_RECORD = 1;
+    static constexpr uint8_t DELETE_RECORD = 2;
+    static constexpr size_t MIN_MAP_SIZE = 1UL << 26;
+    static constexpr uint64_t INDEX_SLOTS_OFFSET = 64;
+    static constexpr uint64_t MIN_INDEX_SLOTS = 1024;
+    // The log past the index file allowed before the index is rewritten, if the index is smaller.
+    static constexpr uint64_t MIN_INDEX_INTERVAL = 1UL << 24;
+
+    static uint64_t compute_checksum(Checkpoint const& checkpoint);
+    static uint64_t compute_checksum(IndexHeader const& header);
+
+    void write_checkpoint(uint64_t sequence, uint64_t log_size);
+    Record read_record(uint64_t pos, uint64_t end) const;
+    bool find_committed(std::string const& key, ValueRef& ref) const;
+    bool find_in_index(std::span<const uint8_t> key, ValueRef& ref) const;
+    void load_index();
+    void write_index_if_due();
+    void unmap_index();
+    void replay_log();
+    void map_file(uint64_t file_size);
+    void sync();
+
+    std::string path_;
+    int fd_ = -1;
+    uint8_t* data_ = nullptr;
+    size_t map_size_ = 0;
+    uint64_t sequence_ = 0;
+    uint64_t log_size_ = 0;
+    uint64_t store_id_ = 0;
+
+    uint8_t const* index_data_ = nullptr;
+    size_t index_map_size_ = 0;
+    uint64_t index_log_size_ = 0;
+    uint64_t index_num_slots_ = 0;
+    uint64_t index_num_entries_ = 0;
+    // The committed log past the index file.
+    std::unordered_map<std::string, ValueRef> tail_index_;
+    std::map<std::string, std::string> puts_;
+    std::set<std::string> deletes_;
+};
+
+} // namespace merkle_tree
+} // namespace stdlib
+} // namespace proof_system::plonk
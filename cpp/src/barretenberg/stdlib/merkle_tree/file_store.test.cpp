@@ -0,0 +1,266 @@
+#include "file_store.hpp"
+#include "memory_tree.hpp"
+#include "merkle_tree.hpp"
+#include <fcntl.h>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+using namespace barretenberg;
+using namespace proof_system::plonk::stdlib::merkle_tree;
+
+namespace {
+std::vector<uint8_t> buffer(std::string const& str)
+{
+    return std::vector<uint8_t>(str.begin(), str.end());
+}
+
+class stdlib_merkle_tree_file_store : public ::testing::Test {
+  protected:
+    void SetUp() override
+    {
+        auto const* test = ::testing::UnitTest::GetInstance()->current_test_info();
+        path = (std::filesystem::temp_directory_path() /
+                (std::string("file_store_") + test->name() + "_" + std::to_string(getpid())))
+                   .string();
+        std::filesystem::remove(path);
+        std::filesystem::remove(path + ".index");
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove(path);
+        std::filesystem::remove(path + ".index");
+    }
+
+    std::string path;
+};
+} // namespace
+
+TEST_F(stdlib_merkle_tree_file_store, staging_commit_and_rollback)
+{
+    FileStore store(path);
+    std::vector<uint8_t> value;
+
+    store.put(buffer("a"), buffer("1"));
+    store.put(buffer("b"), buffer("2"));
+    EXPECT_TRUE(store.get(buffer("a"), value));
+    EXPECT_EQ(value, buffer("1"));
+    store.rollback();
+    EXPECT_FALSE(store.get(buffer("a"), value));
+
+    store.put(buffer("a"), buffer("1"));
+    store.put(buffer("b"), buffer("2"));
+    store.commit();
+    EXPECT_TRUE(store.get(buffer("b"), value));
+    EXPECT_EQ(value, buffer("2"));
+
+    // Staged changes shadow committed values until they are rolled back.
+    store.del(buffer("a"));
+    store.put(buffer("b"), buffer("3"));
+    EXPECT_FALSE(store.get(buffer("a"), value));
+    EXPECT_TRUE(store.get(buffer("b"), value));
+    EXPECT_EQ(value, buffer("3"));
+    store.rollback();
+    EXPECT_TRUE(store.get(buffer("a"), value));
+    EXPECT_TRUE(store.get(buffer("b"), value));
+    EXPECT_EQ(value, buffer("2"));
+
+    store.del(buffer("a"));
+    store.commit();
+    EXPECT_FALSE(store.get(buffer("a"), value));
+}
+
+TEST_F(stdlib_merkle_tree_file_store, reopen)
+{
+    {
+        FileStore store(path);
+        store.put(buffer("a"), buffer("1"));
+        store.put(buffer("b"), buffer("2"));
+        store.commit();
+        store.del(buffer("a"));
+        store.put(buffer("c"), buffer("3"));
+        store.commit();
+        // Never committed.
+        store.put(buffer("d"), buffer("4"));
+    }
+
+    FileStore store(path);
+    std::vector<uint8_t> value;
+    EXPECT_FALSE(store.get(buffer("a"), value));
+    EXPECT_TRUE(store.get(buffer("b"), value));
+    EXPECT_EQ(value, buffer("2"));
+    EXPECT_TRUE(store.get(buffer("c"), value));
+    EXPECT_EQ(value, buffer("3"));
+    EXPECT_FALSE(store.get(buffer("d"), value));
+}
+
+TEST_F(stdlib_merkle_tree_file_store, reopen_replays_log_after_index)
+{
+    uint64_t indexed_size;
+    {
+        FileStore store(path);
+        store.put(buffer("a"), buffer("1"));
+        store.put(buffer("b"), buffer("2"));
+        store.put(buffer("c"), buffer("3"));
+        store.commit();
+        store.write_index();
+        indexed_size = store.log_size();
+        EXPECT_EQ(store.index_log_size(), indexed_size);
+
+        store.del(buffer("a"));
+        store.put(buffer("b"), buffer("4"));
+        store.put(buffer("d"), buffer("5"));
+        store.commit();
+    }
+
+    auto expect_values = [](FileStore const& store) {
+        std::vector<uint8_t> value;
+        EXPECT_FALSE(store.get(buffer("a"), value));
+        EXPECT_TRUE(store.get(buffer("b"), value));
+        EXPECT_EQ(value, buffer("4"));
+        EXPECT_TRUE(store.get(buffer("c"), value));
+        EXPECT_EQ(value, buffer("3"));
+        EXPECT_TRUE(store.get(buffer("d"), value));
+        EXPECT_EQ(value, buffer("5"));
+    };
+    {
+        FileStore store(path);
+        EXPECT_EQ(store.index_log_size(), indexed_size);
+        expect_values(store);
+
+        // A key deleted after the index can be put again.
+        store.put(buffer("a"), buffer("6"));
+        store.commit();
+        store.del(buffer("a"));
+        store.commit();
+        store.write_index();
+        expect_values(store);
+    }
+
+    FileStore store(path);
+    EXPECT_EQ(store.index_log_size(), store.log_size());
+    expect_values(store);
+}
+
+TEST_F(stdlib_merkle_tree_file_store, ignores_stale_index)
+{
+    {
+        FileStore store(path);
+        store.put(buffer("a"), buffer("1"));
+        store.commit();
+        store.put(buffer("b"), buffer("2"));
+        store.commit();
+        store.write_index();
+    }
+
+    // An index ahead of the checkpoint in use, after a torn checkpoint write.
+    {
+        uint8_t garbage = 0xff;
+        int fd = open(path.c_str(), O_WRONLY);
+        ASSERT_EQ(pwrite(fd, &garbage, 1, 0), 1);
+        close(fd);
+    }
+    {
+        FileStore store(path);
+        std::vector<uint8_t> value;
+        EXPECT_EQ(store.index_log_size(), 0ULL);
+        EXPECT_TRUE(store.get(buffer("a"), value));
+        EXPECT_FALSE(store.get(buffer("b"), value));
+    }
+
+    // An index left behind by another store at the same path, whose log is longer than the index covers.
+    std::filesystem::remove(path);
+    const auto long_value = buffer(std::string(200, 'c'));
+    {
+        FileStore store(path);
+        store.put(buffer("c"), long_value);
+        store.commit();
+    }
+    FileStore store(path);
+    std::vector<uint8_t> value;
+    EXPECT_EQ(store.index_log_size(), 0ULL);
+    EXPECT_FALSE(store.get(buffer("a"), value));
+    EXPECT_TRUE(store.get(buffer("c"), value));
+    EXPECT_EQ(value, long_value);
+}
+
+TEST_F(stdlib_merkle_tree_file_store, recovers_last_commit)
+{
+    uint64_t committed_size;
+    {
+        FileStore store(path);
+        store.put(buffer("a"), buffer("1"));
+        store.commit();
+        committed_size = store.log_size();
+    }
+
+    // A commit that wrote its records but crashed before the checkpoint.
+    {
+        std::vector<uint8_t> junk(100, 0xab);
+        int fd = open(path.c_str(), O_WRONLY);
+        ASSERT_EQ(pwrite(fd, junk.data(), junk.size(), (off_t)(FileStore::LOG_OFFSET + committed_size)), 100);
+        close(fd);
+    }
+    {
+        FileStore store(path);
+        std::vector<uint8_t> value;
+        EXPECT_EQ(store.log_size(), committed_size);
+        EXPECT_TRUE(store.get(buffer("a"), value));
+        EXPECT_EQ(value, buffer("1"));
+
+        // The next commit overwrites the junk.
+        store.put(buffer("b"), buffer("2"));
+        store.commit();
+    }
+
+    // A torn write of the latest checkpoint falls back to the previous one.
+    {
+        uint8_t garbage = 0xff;
+        int fd = open(path.c_str(), O_WRONLY);
+        ASSERT_EQ(pwrite(fd, &garbage, 1, 0), 1);
+        close(fd);
+    }
+    FileStore store(path);
+    std::vector<uint8_t> value;
+    EXPECT_EQ(store.log_size(), committed_size);
+    EXPECT_TRUE(store.get(buffer("a"), value));
+    EXPECT_FALSE(store.get(buffer("b"), value));
+}
+
+TEST_F(stdlib_merkle_tree_file_store, merkle_tree_reopen)
+{
+    constexpr size_t depth = 10;
+    MemoryTree memdb(depth);
+
+    {
+        FileStore store(path);
+        MerkleTree db(store, depth);
+        std::vector<fr> values(600);
+        for (size_t i = 0; i < values.size(); ++i) {
+            values[i] = fr::random_element();
+            memdb.update_element(i, values[i]);
+        }
+        db.update_elements(0, values);
+        store.commit();
+        store.write_index();
+
+        for (size_t i = 0; i < 20; ++i) {
+            auto value = fr::random_element();
+            memdb.update_element(i * 37, value);
+            db.update_element(i * 37, value);
+        }
+        store.commit();
+
+        // Never committed.
+        db.update_element(900, fr::random_element());
+    }
+
+    FileStore store(path);
+    MerkleTree db(store, depth);
+    EXPECT_EQ(db.root(), memdb.root());
+    EXPECT_EQ(db.size(), 704ULL);
+    for (size_t i = 0; i < (1 << depth); ++i) {
+        EXPECT_EQ(db.get_hash_path(i), memdb.get_hash_path(i));
+    }
+}
@@ -50,7 +50,8 @@ TEST(stdlib_merkle_tree_hash, compute_tree_root_native_vs_circuit)
 
 TEST(stdlib_merkle_tree_hash, compute_tree_native)
 {
-    constexpr size_t depth = 2;
+    // Deep enough for the lower layers to be split between several batches.
+    constexpr size_t depth = 9;
     merkle_tree::MemoryTree mem_tree(depth);
 
     std::vector<fr> leaves;
@@ -3,6 +3,7 @@
 #include "barretenberg/common/streams.hpp"
 #include <map>
 #include <set>
+#include <span>
 
 namespace proof_system::plonk {
 namespace stdlib {
@@ -17,20 +18,20 @@ class MemoryStore {
     MemoryStore& operator=(MemoryStore const& rhs) = default;
     MemoryStore& operator=(MemoryStore&& rhs) = default;
 
-    bool put(std::vector<uint8_t> const& key, std::vector<uint8_t> const& value)
+    bool put(std::span<const uint8_t> key, std::span<const uint8_t> value)
     {
         auto key_str = to_string(key);
         return put(key_str, value);
     }
 
-    bool put(std::string const& key, std::vector<uint8_t> const& value)
+    bool put(std::string const& key, std::span<const uint8_t> value)
     {
         puts_[key] = to_string(value);
         deletes_.erase(key);
         return true;
     }
 
-    bool del(std::vector<uint8_t> const& key)
+    bool del(std::span<const uint8_t> key)
     {
         auto key_str = to_string(key);
         puts_.erase(key_str);
@@ -38,22 +39,37 @@ class MemoryStore {
         return true;
     };
 
-    bool get(std::vector<uint8_t> const& key, std::vector<uint8_t>& value) { return get(to_string(key), value); }
+    bool get(std::span<const uint8_t> key, std::vector<uint8_t>& value) { return get(to_string(key), value); }
 
     bool get(std::string const& key, std::vector<uint8_t>& value)
+    {
+        std::span<const uint8_t> result;
+        if (!get(key, result)) {
+            return false;
+        }
+        value = std::vector<uint8_t>(result.begin(), result.end());
+        return true;
+    }
+
+    bool get(std::span<const uint8_t> key, std::span<const uint8_t>& value) { return get(to_string(key), value); }
+
+    /**
+     * Sets `value` to a view of the stored value, which stays valid until `key` is next put or deleted, or the store
+     * is committed.
+     */
+    bool get(std::string const& key, std::span<const uint8_t>& value)
     {
         if (deletes_.find(key) != deletes_.end()) {
             return false;
         }
         auto it = puts_.find(key);
         if (it != puts_.end()) {
-            value = std::vector<uint8_t>(it->second.begin(), it->second.end());
+            value = std::span<const uint8_t>((uint8_t const*)it->second.data(), it->second.size());
             return true;
         } else {
-            std::string result;
             auto it = store_.find(key);
             if (it != store_.end()) {
-                value = { it->second.begin(), it->second.end() };
+                value = std::span<const uint8_t>((uint8_t const*)it->second.data(), it->second.size());
                 return true;
             }
             return false;
@@ -79,7 +95,7 @@ class MemoryStore {
     }
 
   private:
-    std::string to_string(std::vector<uint8_t> const& input) { return std::string((char*)input.data(), input.size()); }
+    std::string to_string(std::span<const uint8_t> input) { return std::string((char*)input.data(), input.size()); }
 
     std::map<std::string, std::string> store_;
     std::map<std::string, std::string> puts_;
@@ -12,10 +12,13 @@ MemoryTree::MemoryTree(size_t depth)
     total_size_ = 1UL << depth_;
     hashes_.resize(total_size_ * 2 - 2);
 
-    // Build the entire tree.
+    // Build the entire tree. Every node of a layer holds the same zero hash, so the layers are filled in parallel.
     auto current = fr(0);
     size_t layer_size = total_size_;
     for (size_t offset = 0; offset < hashes_.size(); offset += layer_size, layer_size /= 2) {
+#ifndef NO_MULTITHREADING
+#pragma omp parallel for
+#endif
         for (size_t i = 0; i < layer_size; ++i) {
             hashes_[offset + i] = current;
         }
@@ -25,6 +28,28 @@ MemoryTree::MemoryTree(size_t depth)
     root_ = current;
 }
 
+MemoryTree::MemoryTree(size_t depth, std::vector<fr> const& leaves)
+    : depth_(depth)
+{
+    ASSERT(depth_ >= 1 && depth <= 20);
+    total_size_ = 1UL << depth_;
+    ASSERT(leaves.size() <= total_size_);
+    hashes_.resize(total_size_ * 2 - 2);
+    std::copy(leaves.begin(), leaves.end(), hashes_.begin());
+    std::fill(hashes_.begin() + static_cast<std::ptrdiff_t>(leaves.size()),
+              hashes_.begin() + static_cast<std::ptrdiff_t>(total_size_),
+              fr(0));
+
+    size_t offset = 0;
+    size_t layer_size = total_size_;
+    for (; layer_size > 2; offset += layer_size, layer_size /= 2) {
+        hash_pairs_native(std::span(hashes_).subspan(offset, layer_size),
+                          std::span(hashes_).subspan(offset + layer_size, layer_size / 2));
+    }
+
+    root_ = hash_pair_native(hashes_[offset], hashes_[offset + 1]);
+}
+
 fr_hash_path MemoryTree::get_hash_path(size_t index)
 {
     fr_hash_path path(depth_);
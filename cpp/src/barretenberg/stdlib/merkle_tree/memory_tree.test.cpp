@@ -78,3 +78,21 @@ TEST(stdlib_merkle_tree, test_memory_store_sibling_path)
     EXPECT_EQ(db.get_sibling_path(3), expected03);
     EXPECT_EQ(db.root(), root);
 }
+
+TEST(stdlib_merkle_tree, test_memory_tree_from_leaves)
+{
+    constexpr size_t depth = 8;
+    MemoryTree expected(depth);
+    std::vector<fr> leaves(200);
+    for (size_t i = 0; i < leaves.size(); ++i) {
+        leaves[i] = fr::random_element();
+        expected.update_element(i, leaves[i]);
+    }
+
+    MemoryTree db(depth, leaves);
+    EXPECT_EQ(db.root(), expected.root());
+    EXPECT_EQ(db.hashes_, expected.hashes_);
+    for (size_t i = 0; i < (1 << depth); ++i) {
+        EXPECT_EQ(db.get_hash_path(i), expected.get_hash_path(i));
+    }
+}
@@ -1,6 +1,8 @@
 #include "hash.hpp"
 #include "memory_store.hpp"
+#include "memory_tree.hpp"
 #include "merkle_tree.hpp"
+#include "node_store.hpp"
 #include <benchmark/benchmark.h>
 #include "barretenberg/numeric/random/engine.hpp"
 
@@ -30,30 +32,88 @@ void hash(State& state) noexcept
 }
 BENCHMARK(hash)->MinTime(5);
 
-void update_first_element(State& state) noexcept
+void compute_tree_root_one_pair_at_a_time(State& state) noexcept
 {
-    MemoryStore store;
-    MerkleTree<MemoryStore> db(store, DEPTH);
+    // Build the lookup tables outside of the timed loop.
+    hash_pair_native(VALUES[0], VALUES[1]);
+    for (auto _ : state) {
+        std::vector<fr> layer(VALUES);
+        while (layer.size() > 1) {
+            std::vector<fr> next_layer(layer.size() / 2);
+            for (size_t i = 0; i < next_layer.size(); ++i) {
+                next_layer[i] = hash_pair_native(layer[i * 2], layer[i * 2 + 1]);
+            }
+            layer = std::move(next_layer);
+        }
+        DoNotOptimize(layer[0]);
+    }
+}
+BENCHMARK(compute_tree_root_one_pair_at_a_time)->Unit(benchmark::kMillisecond);
+
+void compute_tree_root(State& state) noexcept
+{
+    hash_pair_native(VALUES[0], VALUES[1]);
+    for (auto _ : state) {
+        DoNotOptimize(compute_tree_root_native(VALUES));
+    }
+}
+BENCHMARK(compute_tree_root)->Unit(benchmark::kMillisecond);
+
+void memory_tree_from_leaves(State& state) noexcept
+{
+    hash_pair_native(VALUES[0], VALUES[1]);
+    for (auto _ : state) {
+        MemoryTree tree(12, VALUES);
+        DoNotOptimize(tree.root());
+    }
+}
+BENCHMARK(memory_tree_from_leaves)->Unit(benchmark::kMillisecond);
+
+template <typename Store> void update_first_element(State& state) noexcept
+{
+    Store store;
+    MerkleTree<Store> db(store, DEPTH);
 
     for (auto _ : state) {
         db.update_element(0, VALUES[1]);
     }
 }
-BENCHMARK(update_first_element)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(update_first_element, MemoryStore)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(update_first_element, NodeStore)->Unit(benchmark::kMillisecond);
 
-void update_elements(State& state) noexcept
+template <typename Store> void update_elements(State& state) noexcept
 {
     for (auto _ : state) {
         state.PauseTiming();
-        MemoryStore store;
-        MerkleTree<MemoryStore> db(store, DEPTH);
+        Store store;
+        MerkleTree<Store> db(store, DEPTH);
         state.ResumeTiming();
         for (size_t i = 0; i < (size_t)state.range(0); ++i) {
             db.update_element(i, VALUES[i]);
         }
     }
 }
-BENCHMARK(update_elements)->Unit(benchmark::kMillisecond)->RangeMultiplier(2)->Range(256, MAX);
+BENCHMARK_TEMPLATE(update_elements, MemoryStore)->Unit(benchmark::kMillisecond)->RangeMultiplier(2)->Range(256, MAX);
+BENCHMARK_TEMPLATE(update_elements, NodeStore)->Unit(benchmark::kMillisecond)->RangeMultiplier(2)->Range(256, MAX);
+
+template <typename Store> void update_elements_batched(State& state) noexcept
+{
+    for (auto _ : state) {
+        state.PauseTiming();
+        Store store;
+        MerkleTree<Store> db(store, DEPTH);
+        state.ResumeTiming();
+        db.update_elements(0, std::span(VALUES.data(), (size_t)state.range(0)));
+    }
+}
+BENCHMARK_TEMPLATE(update_elements_batched, MemoryStore)
+    ->Unit(benchmark::kMillisecond)
+    ->RangeMultiplier(2)
+    ->Range(256, MAX);
+BENCHMARK_TEMPLATE(update_elements_batched, NodeStore)
+    ->Unit(benchmark::kMillisecond)
+    ->RangeMultiplier(2)
+    ->Range(256, MAX);
 
 void update_random_elements(State& state) noexcept
 {
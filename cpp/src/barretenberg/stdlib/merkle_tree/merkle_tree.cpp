@@ -1,11 +1,14 @@
 #include "merkle_tree.hpp"
+#include "file_store.hpp"
 #include "hash.hpp"
 #include "memory_store.hpp"
+#include "node_store.hpp"
 #include "barretenberg/common/net.hpp"
 #include <iostream>
 #include "barretenberg/numeric/bitop/count_leading_zeros.hpp"
 #include "barretenberg/numeric/bitop/keep_n_lsb.hpp"
 #include "barretenberg/numeric/uint128/uint128.hpp"
+#include <algorithm>
 #include <sstream>
 
 namespace proof_system::plonk {
@@ -19,6 +22,42 @@ template <typename T> inline bool bit_set(T const& index, size_t i)
     return bool((index >> i) & 0x1);
 }
 
+/**
+ * Nodes are stored under the serialised node hash. The keys and values below are built in fixed-size buffers, so that
+ * stores which take spans are not handed a freshly allocated vector for every access.
+ */
+inline std::array<uint8_t, 32> to_array(fr const& value)
+{
+    std::array<uint8_t, 32> buf;
+    fr::serialize_to_buffer(value, buf.data());
+    return buf;
+}
+
+inline std::array<uint8_t, 32> node_key(fr const& node)
+{
+    return to_array(node);
+}
+
+inline std::array<uint8_t, 33> leaf_key(uint8_t tree_id, uint256_t const& index)
+{
+    using serialize::write;
+    std::array<uint8_t, 33> key;
+    auto it = key.data();
+    write(it, tree_id);
+    write(it, index);
+    return key;
+}
+
+inline std::array<uint8_t, 64> meta_value(fr const& root, uint256_t const& size)
+{
+    using serialize::write;
+    std::array<uint8_t, 64> value;
+    auto it = value.data();
+    write(it, root);
+    write(it, size);
+    return value;
+}
+
 template <typename Store>
 MerkleTree<Store>::MerkleTree(Store& store, size_t depth, uint8_t tree_id)
     : store_(store)
@@ -48,16 +87,16 @@ template <typename Store> MerkleTree<Store>::~MerkleTree() {}
 
 template <typename Store> fr MerkleTree<Store>::root() const
 {
-    std::vector<uint8_t> root;
-    std::vector<uint8_t> key = { tree_id_ };
+    std::span<const uint8_t> root;
+    std::array<uint8_t, 1> key = { tree_id_ };
     bool status = store_.get(key, root);
     return status ? from_buffer<fr>(root) : hash_pair_native(zero_hashes_.back(), zero_hashes_.back());
 }
 
 template <typename Store> typename MerkleTree<Store>::index_t MerkleTree<Store>::size() const
 {
-    std::vector<uint8_t> size_buf;
-    std::vector<uint8_t> key = { tree_id_ };
+    std::span<const uint8_t> size_buf;
+    std::array<uint8_t, 1> key = { tree_id_ };
     bool status = store_.get(key, size_buf);
     return status ? from_buffer<index_t>(size_buf, 32) : 0;
 }
@@ -66,8 +105,8 @@ template <typename Store> fr_hash_path MerkleTree<Store>::get_hash_path(index_t
 {
     fr_hash_path path(depth_);
 
-    std::vector<uint8_t> data;
-    bool status = store_.get(root().to_buffer(), data);
+    std::span<const uint8_t> data;
+    bool status = store_.get(node_key(root()), data);
 
     for (size_t i = depth_ - 1; i < depth_; --i) {
         if (!status) {
@@ -83,7 +122,7 @@ template <typename Store> fr_hash_path MerkleTree<Store>::get_hash_path(index_t
             path[i] = std::make_pair(left, right);
             bool is_right = bit_set(index, i);
             auto it = data.data() + (is_right ? 32 : 0);
-            status = store_.get(std::vector<uint8_t>(it, it + 32), data);
+            status = store_.get(std::span<const uint8_t>(it, 32), data);
         } else {
             // This is a stump. The hash path can be fully restored from this node.
             // In case of a stump, we store: [key : (value, local_index, true)], i.e. 65-byte data.
@@ -136,19 +175,30 @@ template <typename Store> fr_hash_path MerkleTree<Store>::get_hash_path(index_t
 template <typename Store> fr MerkleTree<Store>::update_element(index_t index, fr const& value)
 {
     auto leaf = value;
-    using serialize::write;
-    std::vector<uint8_t> leaf_key;
-    write(leaf_key, tree_id_);
-    write(leaf_key, index);
-    store_.put(leaf_key, to_buffer(leaf));
+    store_.put(leaf_key(tree_id_, index), to_array(leaf));
 
     auto r = update_element(root(), leaf, index, depth_);
 
-    std::vector<uint8_t> meta_key = { tree_id_ };
-    std::vector<uint8_t> meta_buf;
-    write(meta_buf, r);
-    write(meta_buf, index + 1);
-    store_.put(meta_key, meta_buf);
+    std::array<uint8_t, 1> meta_key = { tree_id_ };
+    store_.put(meta_key, meta_value(r, index + 1));
+
+    return r;
+}
+
+template <typename Store> fr MerkleTree<Store>::update_elements(index_t start_index, std::span<const fr> values)
+{
+    if (values.empty()) {
+        return root();
+    }
+
+    for (size_t i = 0; i < values.size(); ++i) {
+        store_.put(leaf_key(tree_id_, start_index + index_t(i)), to_array(values[i]));
+    }
+
+    auto r = update_elements(root(), values, start_index, depth_);
+
+    std::array<uint8_t, 1> meta_key = { tree_id_ };
+    store_.put(meta_key, meta_value(r, start_index + index_t(values.size())));
 
     return r;
 }
@@ -197,8 +247,8 @@ fr MerkleTree<Store>::update_element(fr const& root, fr const& value, index_t in
         return value;
     }
 
-    std::vector<uint8_t> data;
-    auto status = store_.get(root.to_buffer(), data);
+    std::span<const uint8_t> data;
+    auto status = store_.get(node_key(root), data);
 
     if (!status) {
         fr key = compute_zero_path_hash(height, index, value);
@@ -247,6 +297,111 @@ fr MerkleTree<Store>::update_element(fr const& root, fr const& value, index_t in
     }
 }
 
+template <typename Store>
+fr MerkleTree<Store>::update_elements(fr const& root, std::span<const fr> values, index_t index, size_t height)
+{
+    // Base layer of recursion at height = 0.
+    if (height == 0) {
+        return values[0];
+    }
+
+    std::span<const uint8_t> data;
+    auto status = store_.get(node_key(root), data);
+
+    if (!status) {
+        return build_subtree(values, index, height);
+    }
+
+    fr left, right;
+    if (data.size() == 65) {
+        // We've come across a stump.
+        index_t existing_index = from_buffer<index_t>(data, 32);
+        if (existing_index >= index && existing_index < index + index_t(values.size())) {
+            // The stumps element is overwritten, so the subtree only holds the new elements.
+            return build_subtree(values, index, height);
+        }
+
+        // Push the stump down one level, next to an empty subtree, and update it as a regular node.
+        fr existing_value = from_buffer<fr>(data, 0);
+        index_t stump_index = numeric::keep_n_lsb(existing_index, height - 1);
+        fr stump_hash = compute_zero_path_hash(height - 1, stump_index, existing_value);
+        if (height > 1) {
+            put_stump(stump_hash, stump_index, existing_value);
+        }
+        bool is_right = bit_set(existing_index, height - 1);
+        left = is_right ? zero_hashes_[height - 1] : stump_hash;
+        right = is_right ? stump_hash : zero_hashes_[height - 1];
+    } else {
+        // If its not a stump, the data size must be 64 bytes.
+        ASSERT(data.size() == 64);
+        left = from_buffer<fr>(data, 0);
+        right = from_buffer<fr>(data, 32);
+    }
+
+    // Split the elements between the left and right subtrees.
+    const index_t half = index_t(1) << (height - 1);
+    size_t num_left = 0;
+    if (index < half) {
+        num_left = static_cast<size_t>(std::min(index_t(values.size()), half - index));
+    }
+
+    fr new_left = left;
+    fr new_right = right;
+    if (num_left > 0) {
+        new_left = update_elements(left, values.subspan(0, num_left), index, height - 1);
+    }
+    if (num_left < values.size()) {
+        index_t right_index = num_left > 0 ? index_t(0) : index - half;
+        new_right = update_elements(right, values.subspan(num_left), right_index, height - 1);
+    }
+    auto new_root = hash_pair_native(new_left, new_right);
+    put(new_root, new_left, new_right);
+
+    // Remove the old nodes only while rolling back in recursion.
+    if (!(new_left == left)) {
+        remove(left);
+    }
+    if (!(new_right == right)) {
+        remove(right);
+    }
+    return new_root;
+}
+
+template <typename Store>
+fr MerkleTree<Store>::build_subtree(std::span<const fr> values, index_t index, size_t height)
+{
+    if (values.size() == 1) {
+        fr key = compute_zero_path_hash(height, index, values[0]);
+        put_stump(key, index, values[0]);
+        return key;
+    }
+
+    // `layer` holds the nodes of the current level from local index `index` on. Nodes whose sibling lies outside
+    // of `layer` are paired with an empty subtree.
+    std::vector<fr> layer(values.begin(), values.end());
+    for (size_t i = 0; i < height; ++i) {
+        const size_t offset = bit_set(index, 0) ? 1 : 0;
+        auto get_child = [&](size_t j) {
+            return (j < offset || j - offset >= layer.size()) ? zero_hashes_[i] : layer[j - offset];
+        };
+
+        std::vector<fr> parents((layer.size() + offset + 1) / 2);
+        std::vector<fr> children(parents.size() * 2);
+        for (size_t j = 0; j < children.size(); ++j) {
+            children[j] = get_child(j);
+        }
+        hash_pairs_native(children, parents);
+        for (size_t j = 0; j < parents.size(); ++j) {
+            put(parents[j], children[2 * j], children[2 * j + 1]);
+        }
+
+        layer = std::move(parents);
+        index = index >> 1;
+    }
+
+    return layer[0];
+}
+
 template <typename Store> fr MerkleTree<Store>::compute_zero_path_hash(size_t height, index_t index, fr const& value)
 {
     fr current = value;
@@ -267,28 +422,36 @@ template <typename Store> fr MerkleTree<Store>::compute_zero_path_hash(size_t he
 
 template <typename Store> void MerkleTree<Store>::put(fr const& key, fr const& left, fr const& right)
 {
-    std::vector<uint8_t> value;
-    write(value, left);
-    write(value, right);
-    store_.put(key.to_buffer(), value);
+    using serialize::write;
+    std::array<uint8_t, 64> value;
+    auto it = value.data();
+    write(it, left);
+    write(it, right);
+    store_.put(node_key(key), value);
 }
 
 template <typename Store> void MerkleTree<Store>::put_stump(fr const& key, index_t index, fr const& value)
 {
-    std::vector<uint8_t> buf;
-    write(buf, value);
-    write(buf, index);
+    using serialize::write;
+    std::array<uint8_t, 65> buf;
+    auto it = buf.data();
+    write(it, value);
+    write(it, index);
     // Add an additional byte, to signify we are a stump.
-    write(buf, true);
-    store_.put(key.to_buffer(), buf);
+    write(it, true);
+    store_.put(node_key(key), buf);
 }
 
 template <typename Store> void MerkleTree<Store>::remove(fr const& key)
 {
-    store_.del(key.to_buffer());
+    store_.del(node_key(key));
 }
 
 template class MerkleTree<MemoryStore>;
+template class MerkleTree<NodeStore>;
+#ifndef __wasm__
+template class MerkleTree<FileStore>;
+#endif
 
 } // namespace merkle_tree
 } // namespace stdlib
@@ -1,6 +1,7 @@
 #pragma once
 #include "hash_path.hpp"
 #include "barretenberg/stdlib/primitives/field/field.hpp"
+#include <span>
 
 namespace proof_system::plonk {
 namespace stdlib {
@@ -9,6 +10,8 @@ namespace merkle_tree {
 using namespace barretenberg;
 
 class MemoryStore;
+class NodeStore;
+class FileStore;
 
 template <typename Store> class MerkleTree {
   public:
@@ -23,6 +26,13 @@ template <typename Store> class MerkleTree {
 
     fr update_element(index_t index, fr const& value);
 
+    /**
+     * Sets the leaves from `start_index` to `start_index + values.size() - 1` to `values` and returns the new root.
+     * The new leaves are hashed up level by level, and each node on the way to the root is rehashed once, rather
+     * than once per leaf.
+     */
+    fr update_elements(index_t start_index, std::span<const fr> values);
+
     fr root() const;
 
     size_t depth() const { return depth_; }
@@ -43,6 +53,18 @@ template <typename Store> class MerkleTree {
      */
     fr update_element(fr const& root, fr const& value, index_t index, size_t height);
 
+    /**
+     * Updates the subtree of `height` with root `root`, setting its leaves from local index `index` on to `values`,
+     * and returns the new root of the subtree.
+     */
+    fr update_elements(fr const& root, std::span<const fr> values, index_t index, size_t height);
+
+    /**
+     * Builds an otherwise empty subtree of `height` holding `values` from local index `index` on, and returns its
+     * root. The nodes of each level are hashed in parallel.
+     */
+    fr build_subtree(std::span<const fr> values, index_t index, size_t height);
+
     fr get_element(fr const& root, index_t index, size_t height);
 
     /**
@@ -96,6 +118,10 @@ template <typename Store> class MerkleTree {
 };
 
 extern template class MerkleTree<MemoryStore>;
+extern template class MerkleTree<NodeStore>;
+#ifndef __wasm__
+extern template class MerkleTree<FileStore>;
+#endif
 
 } // namespace merkle_tree
 } // namespace stdlib
@@ -1,6 +1,7 @@
 #include "merkle_tree.hpp"
 #include "memory_store.hpp"
 #include "memory_tree.hpp"
+#include "node_store.hpp"
 #include "barretenberg/common/streams.hpp"
 #include "barretenberg/common/test.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
@@ -135,4 +136,87 @@ TEST(stdlib_merkle_tree, test_get_hash_path_layers)
         EXPECT_NE(before[2], after[2]);
     }
 }
+
+TEST(stdlib_merkle_tree, test_update_elements)
+{
+    constexpr size_t depth = 10;
+    MemoryTree memdb(depth);
+
+    MemoryStore store;
+    MerkleTree db(store, depth);
+
+    // Nodes are stored by hash, so distinct values keep equal subtrees from sharing nodes.
+    auto update_both = [&](size_t start_index, size_t num_elements) {
+        std::vector<fr> values(num_elements);
+        for (size_t i = 0; i < num_elements; ++i) {
+            values[i] = fr::random_element();
+            memdb.update_element(start_index + i, values[i]);
+        }
+        EXPECT_EQ(db.update_elements(start_index, values), memdb.root());
+        EXPECT_EQ(db.size(), start_index + num_elements);
+    };
+
+    // Single elements, stored as stumps.
+    db.update_element(5, VALUES[5]);
+    memdb.update_element(5, VALUES[5]);
+    db.update_element(700, VALUES[700]);
+    memdb.update_element(700, VALUES[700]);
+    db.update_element(1000, VALUES[1000]);
+    memdb.update_element(1000, VALUES[1000]);
+
+    // A block overwriting both the stump at 5 and the one at 700.
+    update_both(3, 698);
+    // Blocks next to existing elements and next to a stump in the same subtree.
+    update_both(701, 6);
+    update_both(990, 5);
+    // A single element and a block overwriting existing nodes.
+    update_both(1023, 1);
+    update_both(100, 200);
+    auto value = fr::random_element();
+    db.update_element(702, value);
+    memdb.update_element(702, value);
+
+    for (size_t i = 0; i < (1 << depth); ++i) {
+        EXPECT_EQ(db.get_hash_path(i), memdb.get_hash_path(i));
+    }
+    EXPECT_EQ(db.root(), memdb.root());
+}
+
+TEST(stdlib_merkle_tree, test_node_store_vs_memory_consistency)
+{
+    constexpr size_t depth = 10;
+    MemoryTree memdb(depth);
+
+    NodeStore store;
+    MerkleTree db(store, depth);
+
+    std::vector<size_t> indicies(1 << depth);
+    std::iota(indicies.begin(), indicies.end(), 0);
+    std::random_device rd;
+    std::mt19937 g(rd());
+    std::shuffle(indicies.begin(), indicies.end(), g);
+
+    for (size_t i = 0; i < indicies.size(); ++i) {
+        size_t idx = indicies[i];
+        auto value = fr::random_element();
+        memdb.update_element(idx, value);
+        db.update_element(idx, value);
+    }
+    std::vector<fr> values(300);
+    for (auto& value : values) {
+        value = fr::random_element();
+    }
+    for (size_t i = 0; i < values.size(); ++i) {
+        memdb.update_element(500 + i, values[i]);
+    }
+    db.update_elements(500, values);
+
+    for (size_t i = 0; i < indicies.size(); ++i) {
+        EXPECT_EQ(db.get_hash_path(i), memdb.get_hash_path(i));
+    }
+
+    EXPECT_EQ(db.root(), memdb.root());
+    EXPECT_EQ(db.size(), 800ULL);
+}
+
 } // namespace proof_system::test_stdlib_merkle_tree
\ No newline at end of file
@@ -0,0 +1,363 @@
+#pragma once
+#include "barretenberg/common/assert.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace proof_system::plonk {
+namespace stdlib {
+namespace merkle_tree {
+
+/**
+ * A key-value store specialised for `MerkleTree`, whose keys are at most 33 bytes (a node hash, or a tree id followed
+ * by a leaf index) and whose values are at most 65 bytes (a stump).
+ *
+ * Values live in fixed-size records allocated from an arena of fixed-size blocks, so a record never moves and `get`
+ * returns a span over it instead of copying the value out. Records are found through an open-addressing hash table
+ * with linear probing, which holds 32-bit record indices. A value that does not fit in a record is kept in a side
+ * vector, and its record holds the index of it there.
+ *
+ * Puts and deletes are staged as in `MemoryStore`: `get` sees them at once, `commit()` keeps them and `rollback()`
+ * returns the store to its state at the last commit. A put or delete of a committed record leaves it in the arena and
+ * logs it, so that `rollback()` can put it back; `commit()` frees the records logged since the last commit. Records
+ * put since the last commit are overwritten in place.
+ *
+ * A span returned by `get` stays valid until its key is next put or deleted, or the store is rolled back.
+ */
+class NodeStore {
+  public:
+    static constexpr size_t MAX_KEY_SIZE = 33;
+    static constexpr size_t MAX_VALUE_SIZE = 65;
+
+    NodeStore() { slots_.resize(MIN_CAPACITY, EMPTY); }
+
+    NodeStore(NodeStore const& rhs) = delete;
+    NodeStore(NodeStore&& rhs) = default;
+    NodeStore& operator=(NodeStore const& rhs) = delete;
+    NodeStore& operator=(NodeStore&& rhs) = default;
+
+    bool put(std::span<const uint8_t> key, std::span<const uint8_t> value)
+    {
+        ASSERT(key.size() <= MAX_KEY_SIZE);
+        size_t slot = find_slot(key);
+        if (is_record(slots_[slot]) && get_record(slots_[slot]).generation == generation_) {
+            set_value(get_record(slots_[slot]), value);
+            return true;
+        }
+
+        // The key is absent, or held by a committed record: log it before it changes.
+        log_change(key, slots_[slot]);
+        if (is_record(slots_[slot])) {
+            slots_[slot] = allocate_record();
+        } else {
+            slot = insert_slot(key, slot, allocate_record());
+        }
+        Record& record = get_record(slots_[slot]);
+        std::memcpy(record.key.data(), key.data(), key.size());
+        record.key_size = static_cast<uint8_t>(key.size());
+        set_value(record, value);
+        return true;
+    }
+
+    bool del(std::span<const uint8_t> key)
+    {
+        ASSERT(key.size() <= MAX_KEY_SIZE);
+        const size_t slot = find_slot(key);
+        const uint32_t index = slots_[slot];
+        if (!is_record(index)) {
+            return true;
+        }
+        if (get_record(index).generation == generation_) {
+            free_record(index);
+        } else {
+            log_change(key, index);
+        }
+        slots_[slot] = DELETED;
+        --num_records_;
+        ++num_deleted_slots_;
+        return true;
+    }
+
+    bool get(std::span<const uint8_t> key, std::span<const uint8_t>& value) const
+    {
+        if (key.size() > MAX_KEY_SIZE) {
+            return false;
+        }
+        const uint32_t index = slots_[find_slot(key)];
+        if (!is_record(index)) {
+            return false;
+        }
+        const Record& record = get_record(index);
+        if (record.size == LARGE_VALUE) {
+            value = std::span<const uint8_t>(large_values_[get_large_value_index(record)]);
+        } else {
+            value = std::span<const uint8_t>(record.value.data(), record.size);
+        }
+        return true;
+    }
+
+    bool get(std::span<const uint8_t> key, std::vector<uint8_t>& value) const
+    {
+        std::span<const uint8_t> result;
+        if (!get(key, result)) {
+            return false;
+        }
+        value.assign(result.begin(), result.end());
+        return true;
+    }
+
+    void commit()
+    {
+        for (const auto& change : changes_) {
+            if (is_record(change.index)) {
+                free_record(change.index);
+            }
+        }
+        changes_.clear();
+        ++generation_;
+    }
+
+    void rollback()
+    {
+        // A key may have been logged more than once (e.g. deleted, then put again), so undo the changes newest first.
+        for (auto it = changes_.rbegin(); it != changes_.rend(); ++it) {
+            const auto key = std::span<const uint8_t>(it->key.data(), it->key_size);
+            size_t slot = find_slot(key);
+            if (is_record(slots_[slot])) {
+                free_record(slots_[slot]);
+                slots_[slot] = DELETED;
+                --num_records_;
+                ++num_deleted_slots_;
+                slot = find_slot(key);
+            }
+            if (is_record(it->index)) {
+                insert_slot(key, slot, it->index);
+            }
+        }
+        changes_.clear();
+    }
+
+    // The number of keys held.
+    size_t num_nodes() const { return num_records_; }
+
+  private:
+    struct Record {
+        std::array<uint8_t, MAX_KEY_SIZE> key;
+        uint8_t key_size;
+        std::array<uint8_t, MAX_VALUE_SIZE> value;
+        // The size of the value, or `LARGE_VALUE`, in which case `value` holds its index in `large_values_`.
+        uint8_t size;
+        // The number of commits before the record was put.
+        uint32_t generation;
+    };
+
+    // A key that was put or deleted, and the committed record that held it before, if any.
+    struct Change {
+        std::array<uint8_t, MAX_KEY_SIZE> key;
+        uint8_t key_size;
+        uint32_t index;
+    };
+
+    static constexpr uint32_t EMPTY = std::numeric_limits<uint32_t>::max();
+    static constexpr uint32_t DELETED = EMPTY - 1;
+    static constexpr uint8_t LARGE_VALUE = std::numeric_limits<uint8_t>::max();
+    static constexpr size_t MIN_CAPACITY = 1024;
+    static constexpr size_t LOG_RECORDS_PER_BLOCK = 12;
+    static constexpr size_t RECORDS_PER_BLOCK = 1UL << LOG_RECORDS_PER_BLOCK;
+
+    static bool is_record(uint32_t index) { return index < DELETED; }
+
+    /**
+     * Keys are field elements, or small indices, so fold the words of the key together and use the top bits of a
+     * multiplicative hash, which spreads the low bits over the table.
+     */
+    size_t hash(std::span<const uint8_t> key) const
+    {
+        uint64_t folded = key.size();
+        for (size_t i = 0; i < key.size(); i += sizeof(uint64_t)) {
+            uint64_t word = 0;
+            std::memcpy(&word, key.data() + i, std::min(sizeof(uint64_t), key.size() - i));
+            folded ^= std::rotl(word, static_cast<int>((i * 2) & 63));
+        }
+        return static_cast<size_t>((folded * 0x9e3779b97f4a7c15ULL) >> (64 - log_capacity_));
+    }
+
+    /**
+     * Returns the slot holding `key` if there is one, otherwise the slot to insert it at: the first deleted slot on
+     * its probe sequence, or the empty slot that ends it.
+     */
+    size_t find_slot(std::span<const uint8_t> key) const
+    {
+        const size_t mask = slots_.size() - 1;
+        size_t first_deleted = slots_.size();
+        for (size_t slot = hash(key);; slot = (slot + 1) & mask) {
+            const uint32_t index = slots_[slot];
+            if (index == EMPTY) {
+                return first_deleted < slots_.size() ? first_deleted : slot;
+            }
+            if (index == DELETED) {
+                if (first_deleted == slots_.size()) {
+                    first_deleted = slot;
+                }
+                continue;
+            }
+            const Record& record = get_record(index);
+            if (record.key_size == key.size() && std::memcmp(record.key.data(), key.data(), key.size()) == 0) {
+                return slot;
+            }
+        }
+    }
+
+    /**
+     * Fills the free slot `slot`, found for `key` by `find_slot`, with the record `index` and returns the slot, which
+     * moves if the table has to grow first.
+     */
+    size_t insert_slot(std::span<const uint8_t> key, size_t slot, uint32_t index)
+    {
+        if (slots_[slot] == DELETED) {
+            --num_deleted_slots_;
+        } else if ((num_records_ + num_deleted_slots_ + 1) * 4 > slots_.size() * 3) {
+            // Keep the table at most 3/4 full, counting deleted slots, so that probe sequences stay short.
+            rehash();
+            slot = find_slot(key);
+        }
+        slots_[slot] = index;
+        ++num_records_;
+        return slot;
+    }
+
+    Record& get_record(uint32_t index)
+    {
+        return blocks_[index >> LOG_RECORDS_PER_BLOCK][index & (RECORDS_PER_BLOCK - 1)];
+    }
+
+    const Record& get_record(uint32_t index) const
+    {
+        return blocks_[index >> LOG_RECORDS_PER_BLOCK][index & (RECORDS_PER_BLOCK - 1)];
+    }
+
+    static uint32_t get_large_value_index(const Record& record)
+    {
+        uint32_t index;
+        std::memcpy(&index, record.value.data(), sizeof(index));
+        return index;
+    }
+
+    void set_value(Record& record, std::span<const uint8_t> value)
+    {
+        const bool was_large = record.size == LARGE_VALUE;
+        if (value.size() <= MAX_VALUE_SIZE) {
+            if (was_large) {
+                const uint32_t large_index = get_large_value_index(record);
+                large_values_[large_index] = std::vector<uint8_t>();
+                free_large_values_.push_back(large_index);
+            }
+            std::memcpy(record.value.data(), value.data(), value.size());
+            record.size = static_cast<uint8_t>(value.size());
+            return;
+        }
+        uint32_t index;
+        if (was_large) {
+            index = get_large_value_index(record);
+        } else if (!free_large_values_.empty()) {
+            index = free_large_values_.back();
+            free_large_values_.pop_back();
+        } else {
+            index = static_cast<uint32_t>(large_values_.size());
+            large_values_.emplace_back();
+        }
+        large_values_[index].assign(value.begin(), value.end());
+        std::memcpy(record.value.data(), &index, sizeof(index));
+        record.size = LARGE_VALUE;
+    }
+
+    void log_change(std::span<const uint8_t> key, uint32_t index)
+    {
+        Change& change = changes_.emplace_back();
+        std::memcpy(change.key.data(), key.data(), key.size());
+        change.key_size = static_cast<uint8_t>(key.size());
+        change.index = index;
+    }
+
+    uint32_t allocate_record()
+    {
+        uint32_t index;
+        if (!free_records_.empty()) {
+            index = free_records_.back();
+            free_records_.pop_back();
+        } else {
+            if (num_allocated_ == blocks_.size() * RECORDS_PER_BLOCK) {
+                blocks_.push_back(std::make_unique<Record[]>(RECORDS_PER_BLOCK));
+            }
+            ASSERT(num_allocated_ < DELETED);
+            index = static_cast<uint32_t>(num_allocated_++);
+        }
+        Record& record = get_record(index);
+        record.size = 0;
+        record.generation = generation_;
+        return index;
+    }
+
+    void free_record(uint32_t index)
+    {
+        Record& record = get_record(index);
+        if (record.size == LARGE_VALUE) {
+            const uint32_t large_index = get_large_value_index(record);
+            large_values_[large_index] = std::vector<uint8_t>();
+            free_large_values_.push_back(large_index);
+            record.size = 0;
+        }
+        free_records_.push_back(index);
+    }
+
+    /**
+     * Rebuilds the table without deleted slots. The capacity is doubled unless deleted slots make up most of the load.
+     * Records stay where they are, so outstanding spans remain valid.
+     */
+    void rehash()
+    {
+        if (num_records_ * 2 >= num_deleted_slots_) {
+            ++log_capacity_;
+        }
+        std::vector<uint32_t> old_slots(1UL << log_capacity_, EMPTY);
+        std::swap(slots_, old_slots);
+        num_deleted_slots_ = 0;
+
+        const size_t mask = slots_.size() - 1;
+        for (const uint32_t index : old_slots) {
+            if (!is_record(index)) {
+                continue;
+            }
+            const Record& record = get_record(index);
+            size_t slot = hash(std::span<const uint8_t>(record.key.data(), record.key_size));
+            while (slots_[slot] != EMPTY) {
+                slot = (slot + 1) & mask;
+            }
+            slots_[slot] = index;
+        }
+    }
+
+    size_t log_capacity_ = 10;
+    std::vector<uint32_t> slots_;
+    size_t num_records_ = 0;
+    size_t num_deleted_slots_ = 0;
+
+    std::vector<std::unique_ptr<Record[]>> blocks_;
+    size_t num_allocated_ = 0;
+    std::vector<uint32_t> free_records_;
+
+    std::vector<std::vector<uint8_t>> large_values_;
+    std::vector<uint32_t> free_large_values_;
+
+    uint32_t generation_ = 0;
+    std::vector<Change> changes_;
+};
+
+} // namespace merkle_tree
+} // namespace stdlib
+} // namespace proof_system::plonk
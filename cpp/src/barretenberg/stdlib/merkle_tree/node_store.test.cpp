@@ -0,0 +1,221 @@
+#include "node_store.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+#include <gtest/gtest.h>
+#include <optional>
+
+using namespace proof_system::plonk::stdlib::merkle_tree;
+
+namespace {
+auto& engine = numeric::random::get_debug_engine();
+
+std::vector<uint8_t> random_buffer(size_t size)
+{
+    std::vector<uint8_t> buf(size);
+    for (auto& byte : buf) {
+        byte = static_cast<uint8_t>(engine.get_random_uint8());
+    }
+    return buf;
+}
+} // namespace
+
+TEST(stdlib_merkle_tree_node_store, put_get_del)
+{
+    NodeStore store;
+    auto key = random_buffer(32);
+    auto value = random_buffer(64);
+    std::vector<uint8_t> result;
+
+    EXPECT_FALSE(store.get(key, result));
+
+    store.put(key, value);
+    EXPECT_TRUE(store.get(key, result));
+    EXPECT_EQ(result, value);
+
+    // Overwrite with a value of a different size.
+    auto stump = random_buffer(65);
+    store.put(key, stump);
+    std::span<const uint8_t> view;
+    EXPECT_TRUE(store.get(key, view));
+    EXPECT_EQ(std::vector<uint8_t>(view.begin(), view.end()), stump);
+    EXPECT_EQ(store.num_nodes(), 1UL);
+
+    store.del(key);
+    EXPECT_FALSE(store.get(key, result));
+    EXPECT_EQ(store.num_nodes(), 0UL);
+}
+
+TEST(stdlib_merkle_tree_node_store, other_keys_and_large_values)
+{
+    NodeStore store;
+    auto meta_key = random_buffer(1);
+    auto leaf_key = random_buffer(33);
+    auto node_key = random_buffer(32);
+    auto meta = random_buffer(64);
+    auto leaf = random_buffer(32);
+    auto large = random_buffer(100);
+    std::vector<uint8_t> result;
+
+    store.put(meta_key, meta);
+    store.put(leaf_key, leaf);
+    store.put(node_key, large);
+    EXPECT_EQ(store.num_nodes(), 3UL);
+
+    EXPECT_TRUE(store.get(meta_key, result));
+    EXPECT_EQ(result, meta);
+    EXPECT_TRUE(store.get(leaf_key, result));
+    EXPECT_EQ(result, leaf);
+    EXPECT_TRUE(store.get(node_key, result));
+    EXPECT_EQ(result, large);
+
+    // A value that fits replaces the large one.
+    store.put(node_key, leaf);
+    EXPECT_TRUE(store.get(node_key, result));
+    EXPECT_EQ(result, leaf);
+
+    store.del(leaf_key);
+    EXPECT_FALSE(store.get(leaf_key, result));
+    EXPECT_TRUE(store.get(meta_key, result));
+}
+
+TEST(stdlib_merkle_tree_node_store, random_operations)
+{
+    NodeStore store;
+    // The expected value of each key, if present.
+    std::vector<std::vector<uint8_t>> keys;
+    std::vector<std::optional<std::vector<uint8_t>>> expected;
+    size_t num_present = 0;
+
+    // Enough insertions to grow the table and the arena several times, interleaved with deletions and overwrites.
+    for (size_t i = 0; i < 20000; ++i) {
+        const uint32_t choice = engine.get_random_uint32() % 4;
+        if (choice == 0 && !keys.empty()) {
+            const size_t j = engine.get_random_uint32() % keys.size();
+            store.del(keys[j]);
+            if (expected[j].has_value()) {
+                --num_present;
+            }
+            expected[j].reset();
+        } else if (choice == 1 && !keys.empty()) {
+            const size_t j = engine.get_random_uint32() % keys.size();
+            auto value = random_buffer(64);
+            store.put(keys[j], value);
+            if (!expected[j].has_value()) {
+                ++num_present;
+            }
+            expected[j] = value;
+        } else {
+            keys.push_back(random_buffer(32));
+            expected.push_back(random_buffer(65));
+            store.put(keys.back(), *expected.back());
+            ++num_present;
+        }
+    }
+
+    EXPECT_EQ(store.num_nodes(), num_present);
+    for (size_t j = 0; j < keys.size(); ++j) {
+        std::vector<uint8_t> result;
+        EXPECT_EQ(store.get(keys[j], result), expected[j].has_value());
+        if (expected[j].has_value()) {
+            EXPECT_EQ(result, *expected[j]);
+        }
+    }
+}
+
+TEST(stdlib_merkle_tree_node_store, staging_commit_and_rollback)
+{
+    NodeStore store;
+    auto a = random_buffer(32);
+    auto b = random_buffer(33);
+    auto c = random_buffer(32);
+    auto value_1 = random_buffer(64);
+    auto value_2 = random_buffer(65);
+    auto large = random_buffer(100);
+    std::vector<uint8_t> result;
+
+    store.put(a, value_1);
+    store.put(b, value_2);
+    EXPECT_TRUE(store.get(a, result));
+    EXPECT_EQ(result, value_1);
+    store.rollback();
+    EXPECT_FALSE(store.get(a, result));
+    EXPECT_FALSE(store.get(b, result));
+    EXPECT_EQ(store.num_nodes(), 0UL);
+
+    store.put(a, value_1);
+    store.put(b, value_2);
+    store.put(c, large);
+    store.commit();
+    EXPECT_TRUE(store.get(b, result));
+    EXPECT_EQ(result, value_2);
+
+    // Staged changes shadow committed values until they are rolled back.
+    store.del(a);
+    store.put(b, large);
+    store.put(b, value_1);
+    store.put(c, value_2);
+    store.del(c);
+    store.put(c, value_1);
+    EXPECT_FALSE(store.get(a, result));
+    EXPECT_TRUE(store.get(b, result));
+    EXPECT_EQ(result, value_1);
+    EXPECT_TRUE(store.get(c, result));
+    EXPECT_EQ(result, value_1);
+    store.rollback();
+    EXPECT_TRUE(store.get(a, result));
+    EXPECT_EQ(result, value_1);
+    EXPECT_TRUE(store.get(b, result));
+    EXPECT_EQ(result, value_2);
+    EXPECT_TRUE(store.get(c, result));
+    EXPECT_EQ(result, large);
+    EXPECT_EQ(store.num_nodes(), 3UL);
+
+    store.del(a);
+    store.put(c, value_2);
+    store.commit();
+    store.rollback();
+    EXPECT_FALSE(store.get(a, result));
+    EXPECT_TRUE(store.get(c, result));
+    EXPECT_EQ(result, value_2);
+    EXPECT_EQ(store.num_nodes(), 2UL);
+}
+
+TEST(stdlib_merkle_tree_node_store, random_commits_and_rollbacks)
+{
+    NodeStore store;
+    std::vector<std::vector<uint8_t>> keys;
+    for (size_t i = 0; i < 2000; ++i) {
+        keys.push_back(random_buffer(i % 2 == 0 ? 32 : 33));
+    }
+    // The committed and the staged value of each key, if present.
+    std::vector<std::optional<std::vector<uint8_t>>> committed(keys.size());
+    auto staged = committed;
+
+    for (size_t i = 0; i < 50000; ++i) {
+        const uint32_t choice = engine.get_random_uint32() % 100;
+        const size_t j = engine.get_random_uint32() % keys.size();
+        if (choice == 0) {
+            store.commit();
+            committed = staged;
+        } else if (choice == 1) {
+            store.rollback();
+            staged = committed;
+        } else if (choice < 30) {
+            store.del(keys[j]);
+            staged[j].reset();
+        } else {
+            staged[j] = random_buffer(choice < 35 ? 100 : 64);
+            store.put(keys[j], *staged[j]);
+        }
+    }
+
+    size_t num_present = 0;
+    for (size_t j = 0; j < keys.size(); ++j) {
+        std::vector<uint8_t> result;
+        EXPECT_EQ(store.get(keys[j], result), staged[j].has_value());
+        if (staged[j].has_value()) {
+            EXPECT_EQ(result, *staged[j]);
+            ++num_present;
+        }
+    }
+    EXPECT_EQ(store.num_nodes(), num_present);
+}
@@ -1,5 +1,8 @@
 #pragma once
+#include "barretenberg/common/assert.hpp"
 #include "barretenberg/crypto/pedersen_commitment/pedersen.hpp"
+#include <algorithm>
+#include <map>
 
 namespace proof_system::plonk {
 namespace stdlib {
@@ -40,25 +43,69 @@ struct nullifier_leaf {
     barretenberg::fr hash() const { return stdlib::merkle_tree::hash_multiple_native({ value, nextIndex, nextValue }); }
 };
 
-inline std::pair<size_t, bool> find_closest_leaf(std::vector<nullifier_leaf> const& leaves_, fr const& new_value)
+/**
+ * Ordered index from the value of each nullifier leaf to its position in the vector of leaves. It is kept in sync with
+ * that vector so that the low leaf of a new value is found in O(log n) rather than by scanning every leaf.
+ */
+typedef std::map<uint256_t, size_t> nullifier_leaf_index;
+
+/**
+ * Returns the position of the leaf holding `new_value` if there is one, otherwise the position of the leaf with the
+ * largest value below `new_value`. The second element is true if `new_value` is already present.
+ */
+inline std::pair<size_t, bool> find_closest_leaf(nullifier_leaf_index const& index, fr const& new_value)
 {
-    std::vector<uint256_t> diff;
-    bool repeated = false;
     auto new_value_ = uint256_t(new_value);
 
-    for (size_t i = 0; i < leaves_.size(); i++) {
-        auto leaf_value_ = uint256_t(leaves_[i].value);
-        if (leaf_value_ > new_value_) {
-            diff.push_back(leaf_value_);
-        } else if (leaf_value_ == new_value_) {
-            repeated = true;
-            return std::make_pair(i, repeated);
-        } else {
-            diff.push_back(new_value_ - leaf_value_);
+    // The zero leaf is always present, so every value has a leaf at or below it.
+    auto it = index.upper_bound(new_value_);
+    ASSERT(it != index.begin());
+    --it;
+    return std::make_pair(it->second, it->first == new_value_);
+}
+
+/**
+ * Appends a leaf for each of `new_values` that is not already present, in order, and links the new leaves into the
+ * sorted list. All new values are added to the index first, after which the low leaf and the next leaf of each new
+ * value are its neighbours in the index. This gives the same leaves as inserting the values one at a time.
+ *
+ * Returns the positions of the leaves that were added or modified, in increasing order.
+ */
+inline std::vector<size_t> insert_leaves(std::vector<nullifier_leaf>& leaves,
+                                         nullifier_leaf_index& index,
+                                         std::vector<fr> const& new_values)
+{
+    std::vector<nullifier_leaf_index::iterator> inserted;
+    inserted.reserve(new_values.size());
+    for (auto const& value : new_values) {
+        auto [it, is_new] = index.try_emplace(uint256_t(value), leaves.size());
+        if (is_new) {
+            leaves.push_back({ .value = value, .nextIndex = 0, .nextValue = 0 });
+            inserted.push_back(it);
+        }
+    }
+
+    std::vector<size_t> modified;
+    modified.reserve(inserted.size() * 2);
+    for (auto const& it : inserted) {
+        auto& leaf = leaves[it->second];
+        auto next = std::next(it);
+        if (next != index.end()) {
+            leaf.nextIndex = next->second;
+            leaf.nextValue = leaves[next->second].value;
         }
+
+        auto low = std::prev(it);
+        leaves[low->second].nextIndex = it->second;
+        leaves[low->second].nextValue = leaf.value;
+
+        modified.push_back(it->second);
+        modified.push_back(low->second);
     }
-    auto it = std::min_element(diff.begin(), diff.end());
-    return std::make_pair(static_cast<size_t>(it - diff.begin()), repeated);
+
+    std::sort(modified.begin(), modified.end());
+    modified.erase(std::unique(modified.begin(), modified.end()), modified.end());
+    return modified;
 }
 
 } // namespace merkle_tree
@@ -15,6 +15,7 @@ NullifierMemoryTree::NullifierMemoryTree(size_t depth)
     // Build the entire tree.
     nullifier_leaf zero_leaf = { 0, 0, 0 };
     leaves_.push_back(zero_leaf);
+    leaf_index_.emplace(0, 0);
     auto current = zero_leaf.hash();
     update_element(0, current);
     size_t layer_size = total_size_;
@@ -33,7 +34,7 @@ fr NullifierMemoryTree::update_element(fr const& value)
     // Find the leaf with the value closest and less than `value`
     size_t current;
     bool is_already_present;
-    std::tie(current, is_already_present) = find_closest_leaf(leaves_, value);
+    std::tie(current, is_already_present) = find_closest_leaf(leaf_index_, value);
 
     nullifier_leaf new_leaf = { .value = value,
                                 .nextIndex = leaves_[current].nextIndex,
@@ -44,6 +45,7 @@ fr NullifierMemoryTree::update_element(fr const& value)
         leaves_[current].nextValue = value;
 
         // Insert the new leaf with (nextIndex, nextValue) of the current leaf
+        leaf_index_.emplace(uint256_t(value), leaves_.size());
         leaves_.push_back(new_leaf);
     }
 
@@ -60,6 +62,14 @@ fr NullifierMemoryTree::update_element(fr const& value)
     return root;
 }
 
+fr NullifierMemoryTree::update_elements(std::vector<fr> const& values)
+{
+    for (size_t index : insert_leaves(leaves_, leaf_index_, values)) {
+        update_element(index, leaves_[index].hash());
+    }
+    return root_;
+}
+
 } // namespace merkle_tree
 } // namespace stdlib
 } // namespace proof_system::plonk
\ No newline at end of file
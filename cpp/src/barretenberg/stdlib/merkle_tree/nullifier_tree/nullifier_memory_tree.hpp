@@ -77,6 +77,12 @@ class NullifierMemoryTree : public MemoryTree {
 
     fr update_element(fr const& value);
 
+    /**
+     * Inserts each of `values` that is not already present, in order, and returns the new root. The result is the same
+     * as calling `update_element` on each value, but every modified leaf is hashed into the tree only once.
+     */
+    fr update_elements(std::vector<fr> const& values);
+
     const std::vector<barretenberg::fr>& get_hashes() { return hashes_; }
     const std::vector<nullifier_leaf>& get_leaves() { return leaves_; }
     const nullifier_leaf& get_leaf(size_t index) { return leaves_[index]; }
@@ -87,6 +93,7 @@ class NullifierMemoryTree : public MemoryTree {
     using MemoryTree::root_;
     using MemoryTree::total_size_;
     std::vector<nullifier_leaf> leaves_;
+    nullifier_leaf_index leaf_index_;
 };
 
 } // namespace merkle_tree
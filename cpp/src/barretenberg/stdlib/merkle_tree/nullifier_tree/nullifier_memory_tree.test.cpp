@@ -200,4 +200,32 @@ TEST(crypto_nullifier_tree, test_nullifier_tree)
     // Merkle proof at `index` proves non-membership of `new_member`
     auto hash_path = tree.get_hash_path(index);
     EXPECT_TRUE(check_hash_path(tree.root(), hash_path, leaves[index], index));
-}
\ No newline at end of file
+}
+TEST(crypto_nullifier_tree, test_batch_insert)
+{
+    constexpr size_t depth = 8;
+    NullifierMemoryTree sequential(depth);
+    NullifierMemoryTree batched(depth);
+
+    sequential.update_element(30);
+    batched.update_element(30);
+
+    // Includes a value already in the tree and a repeated value.
+    std::vector<fr> values = { 10, 50, 30, 20, 10 };
+    for (size_t i = 0; i < 20; i++) {
+        values.push_back(fr::random_element());
+    }
+
+    fr root;
+    for (auto const& value : values) {
+        root = sequential.update_element(value);
+    }
+
+    EXPECT_EQ(batched.update_elements(values), root);
+    EXPECT_EQ(batched.get_leaves(), sequential.get_leaves());
+    EXPECT_EQ(batched.get_hashes(), sequential.get_hashes());
+
+    // Inserting values that are all present leaves the tree unchanged.
+    EXPECT_EQ(batched.update_elements({ 10, 20 }), root);
+    EXPECT_EQ(batched.get_leaves().size(), sequential.get_leaves().size());
+}
@@ -31,6 +31,7 @@ NullifierTree<Store>::NullifierTree(Store& store, size_t depth, uint8_t tree_id)
     // Insert the zero leaf to the `leaves` and also to the tree at index 0.
     auto zero_leaf = nullifier_leaf{ .value = 0, .nextIndex = 0, .nextValue = 0 };
     leaves.push_back(zero_leaf);
+    leaf_index.emplace(0, 0);
     auto current = zero_leaf.hash();
     update_element(0, current);
     for (size_t i = 0; i < depth; ++i) {
@@ -42,6 +43,8 @@ NullifierTree<Store>::NullifierTree(Store& store, size_t depth, uint8_t tree_id)
 template <typename Store>
 NullifierTree<Store>::NullifierTree(NullifierTree&& other)
     : MerkleTree<Store>(std::move(other))
+    , leaves(std::move(other.leaves))
+    , leaf_index(std::move(other.leaf_index))
 {}
 
 template <typename Store> NullifierTree<Store>::~NullifierTree() {}
@@ -51,7 +54,7 @@ template <typename Store> fr NullifierTree<Store>::update_element(fr const& valu
     // Find the leaf with the value closest and less than `value`
     size_t current;
     bool is_already_present;
-    std::tie(current, is_already_present) = find_closest_leaf(leaves, value);
+    std::tie(current, is_already_present) = find_closest_leaf(leaf_index, value);
 
     nullifier_leaf new_leaf = { .value = value,
                                 .nextIndex = leaves[current].nextIndex,
@@ -62,6 +65,7 @@ template <typename Store> fr NullifierTree<Store>::update_element(fr const& valu
         leaves[current].nextValue = value;
 
         // Insert the new leaf with (nextIndex, nextValue) of the current leaf
+        leaf_index.emplace(uint256_t(value), leaves.size());
         leaves.push_back(new_leaf);
     }
 
@@ -78,6 +82,22 @@ template <typename Store> fr NullifierTree<Store>::update_element(fr const& valu
     return r;
 }
 
+template <typename Store> fr NullifierTree<Store>::update_elements(std::vector<fr> const& values)
+{
+    const size_t first_new_leaf = leaves.size();
+    std::vector<fr> new_leaf_hashes;
+    for (size_t index : insert_leaves(leaves, leaf_index, values)) {
+        if (index < first_new_leaf) {
+            update_element(index, leaves[index].hash());
+        } else {
+            new_leaf_hashes.push_back(leaves[index].hash());
+        }
+    }
+
+    // The new leaves are contiguous, so they are inserted as one block.
+    return MerkleTree<Store>::update_elements(first_new_leaf, new_leaf_hashes);
+}
+
 template class NullifierTree<MemoryStore>;
 
 } // namespace merkle_tree
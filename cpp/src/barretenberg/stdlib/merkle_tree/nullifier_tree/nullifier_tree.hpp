@@ -25,6 +25,13 @@ template <typename Store> class NullifierTree : public MerkleTree<Store> {
 
     fr update_element(fr const& value);
 
+    /**
+     * Inserts each of `values` that is not already present, in order, and returns the new root. The result is the same
+     * as calling `update_element` on each value, but every modified leaf is written to the tree only once and the
+     * new leaves are inserted as a single block.
+     */
+    fr update_elements(std::vector<fr> const& values);
+
   private:
     using MerkleTree<Store>::update_element;
     using MerkleTree<Store>::get_element;
@@ -36,6 +43,7 @@ template <typename Store> class NullifierTree : public MerkleTree<Store> {
     using MerkleTree<Store>::depth_;
     using MerkleTree<Store>::tree_id_;
     std::vector<nullifier_leaf> leaves;
+    nullifier_leaf_index leaf_index;
 };
 
 extern template class NullifierTree<MemoryStore>;
@@ -137,4 +137,25 @@ TEST(stdlib_nullifier_tree, test_get_hash_path_layers)
         EXPECT_EQ(before[1], after[1]);
         EXPECT_NE(before[2], after[2]);
     }
-}
\ No newline at end of file
+}
+TEST(stdlib_nullifier_tree, test_batch_insert)
+{
+    constexpr size_t depth = 10;
+    NullifierMemoryTree memdb(depth);
+
+    MemoryStore store;
+    auto db = NullifierTree(store, depth);
+
+    std::vector<fr> values(VALUES.begin(), VALUES.begin() + 300);
+    values.push_back(VALUES[7]);
+
+    for (auto const& value : values) {
+        memdb.update_element(value);
+    }
+    auto root = db.update_elements(values);
+
+    EXPECT_EQ(root, memdb.root());
+    EXPECT_EQ(db.size(), 301ULL);
+    EXPECT_EQ(db.get_hash_path(123), memdb.get_hash_path(123));
+    EXPECT_EQ(db.get_hash_path(300), memdb.get_hash_path(300));
+}
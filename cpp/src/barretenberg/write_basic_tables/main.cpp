@@ -0,0 +1,45 @@
+#include "barretenberg/plonk/composer/plookup_tables/basic_table_file.hpp"
+#include "barretenberg/plonk/composer/plookup_tables/plookup_tables.hpp"
+#include <chrono>
+#include <iostream>
+#include <memory>
+
+using namespace plookup;
+
+/**
+ * Checks the plookup basic table file kept with a reference string against the tables this build generates, and
+ * writes it again if it is missing or stale (see basic_table_file.hpp). Run it after every upgrade before serving
+ * tables from the file with `use_basic_table_file`, which trusts the file.
+ *
+ * usage: write_basic_tables <crs dir> [table file path]
+ *
+ * The table file path defaults to `get_basic_table_file_path(<crs dir>)`.
+ */
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        std::cerr << "usage: " << argv[0] << " <crs dir> [table file path]" << std::endl;
+        return 1;
+    }
+    const std::string path = argc > 2 ? std::string(argv[2]) : get_basic_table_file_path(argv[1]);
+
+    auto start = std::chrono::steady_clock::now();
+    const bool current = std::make_shared<BasicTableFile>(path)->is_current();
+    auto end = std::chrono::steady_clock::now();
+    std::cout << path << (current ? " is current" : " is missing or stale") << ", checked in "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms" << std::endl;
+    if (current) {
+        return 0;
+    }
+
+    start = std::chrono::steady_clock::now();
+    BasicTableFile::write(path);
+    end = std::chrono::steady_clock::now();
+    if (!std::make_shared<BasicTableFile>(path)->is_current()) {
+        std::cerr << "unable to read " << path << " after writing it" << std::endl;
+        return 1;
+    }
+    std::cout << "built and wrote " << path << " in "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms" << std::endl;
+    return 0;
+}